@@ -0,0 +1,144 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Animation/AnimNode_HitReactRigidBody.h"
+
+#include "HitReact.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimInstanceProxy.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimNode_HitReactRigidBody)
+
+void FAnimNode_HitReactRigidBody::PreUpdate(const UAnimInstance* InAnimInstance)
+{
+	FAnimNode_RigidBody::PreUpdate(InAnimInstance);
+
+	// Find the component that drives us
+	if (!HitReact.IsValid())
+	{
+		const AActor* Owner = InAnimInstance ? InAnimInstance->GetOwningActor() : nullptr;
+		HitReact = Owner ? Owner->FindComponentByClass<UHitReact>() : nullptr;
+	}
+
+	// Copy the latest state while we're still on the game thread
+	UHitReact* Component = HitReact.Get();
+	if (Component && Component->GetBackend() == EHitReactBackend::AnimNode)
+	{
+		BoneWeights = Component->GetAnimBoneWeights();
+		Component->ConsumeAnimImpulses(Impulses);
+	}
+	else
+	{
+		BoneWeights.Reset();
+		Impulses.Reset();
+	}
+}
+
+void FAnimNode_HitReactRigidBody::EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output,
+	TArray<FBoneTransform>& OutBoneTransforms)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FAnimNode_HitReactRigidBody::EvaluateSkeletalControl_AnyThread);
+
+	// Nothing is reacting, pass the pose through
+	if (BoneWeights.Num() == 0)
+	{
+		bSimulating = false;
+		Impulses.Reset();
+		return;
+	}
+
+	// Start from the input pose rather than wherever the simulation was left
+	if (!bSimulating)
+	{
+		bSimulating = true;
+		ResetDynamics(ETeleportType::ResetPhysics);
+	}
+
+	ApplyImpulses(Output);
+
+	FAnimNode_RigidBody::EvaluateSkeletalControl_AnyThread(Output, OutBoneTransforms);
+
+	// Blend each simulated bone with the input pose by its hit react weight
+	const FBoneContainer& BoneContainer = Output.Pose.GetPose().GetBoneContainer();
+	const FReferenceSkeleton& RefSkeleton = BoneContainer.GetReferenceSkeleton();
+	for (FBoneTransform& BoneTransform : OutBoneTransforms)
+	{
+		const FMeshPoseBoneIndex MeshBoneIndex = BoneContainer.MakeMeshPoseIndex(BoneTransform.BoneIndex);
+		const float Weight = BoneWeights.FindRef(RefSkeleton.GetBoneName(MeshBoneIndex.GetInt()));
+
+		const FTransform Simulated = BoneTransform.Transform;
+		BoneTransform.Transform.Blend(Output.Pose.GetComponentSpaceTransform(BoneTransform.BoneIndex), Simulated, Weight);
+	}
+}
+
+void FAnimNode_HitReactRigidBody::ApplyImpulses(const FComponentSpacePoseContext& Output)
+{
+	if (Impulses.Num() == 0)
+	{
+		return;
+	}
+
+	const FBoneContainer& BoneContainer = Output.Pose.GetPose().GetBoneContainer();
+	const FTransform& ComponentTransform = Output.AnimInstanceProxy->GetComponentTransform();
+
+	// Impulses are in world space, the simulation may not be
+	FTransform SimulationToWorld = FTransform::Identity;
+	switch (SimulationSpace)
+	{
+	case ESimulationSpace::ComponentSpace:
+		SimulationToWorld = ComponentTransform;
+		break;
+	case ESimulationSpace::WorldSpace:
+		break;
+	case ESimulationSpace::BaseBoneSpace:
+		{
+			const FCompactPoseBoneIndex BaseBoneIndex = BaseBoneRef.GetCompactPoseIndex(BoneContainer);
+			SimulationToWorld = BaseBoneIndex.IsValid() ?
+				Output.Pose.GetComponentSpaceTransform(BaseBoneIndex) * ComponentTransform : ComponentTransform;
+		}
+		break;
+	default: break;
+	}
+
+	for (const FHitReactAnimImpulse& Impulse : Impulses)
+	{
+		const int32 MeshBoneIndex = BoneContainer.GetPoseBoneIndexForBoneName(Impulse.BoneName);
+		if (MeshBoneIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FCompactPoseBoneIndex BoneIndex = BoneContainer.MakeCompactPoseIndex(FMeshPoseBoneIndex(MeshBoneIndex));
+		if (!BoneIndex.IsValid())
+		{
+			continue;
+		}
+
+		const FVector BoneLocation = (Output.Pose.GetComponentSpaceTransform(BoneIndex) * ComponentTransform).GetLocation();
+		const FVector Location = SimulationToWorld.InverseTransformPosition(BoneLocation);
+		const FVector SimImpulse = SimulationToWorld.InverseTransformVectorNoScale(Impulse.Impulse);
+
+		if (!Impulse.bAngular)
+		{
+			AddImpulseAtLocation(SimImpulse, Location, Impulse.BoneName);
+			continue;
+		}
+
+		// Only linear impulses can be added, so apply the angular impulse as an equal and opposite pair about the bone
+		// Offset and force are perpendicular to the angular impulse, so the pair has no net linear impulse
+		static constexpr float Offset = 10.f;
+		const FVector Axis = SimImpulse.GetSafeNormal();
+		FVector Perpendicular = FVector::CrossProduct(Axis, FVector::UpVector);
+		if (Perpendicular.IsNearlyZero())
+		{
+			Perpendicular = FVector::CrossProduct(Axis, FVector::ForwardVector);
+		}
+		Perpendicular.Normalize();
+
+		const FVector Force = FVector::CrossProduct(SimImpulse, Perpendicular) / (2.f * Offset);
+		AddImpulseAtLocation(Force, Location + Perpendicular * Offset, Impulse.BoneName);
+		AddImpulseAtLocation(-Force, Location - Perpendicular * Offset, Impulse.BoneName);
+	}
+
+	Impulses.Reset();
+}
@@ -0,0 +1,85 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Animation/AnimNode_HitReactSpring.h"
+
+#include "HitReact.h"
+#include "Animation/AnimInstance.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimNode_HitReactSpring)
+
+void FAnimNode_HitReactSpring::PreUpdate(const UAnimInstance* InAnimInstance)
+{
+	// Find the component that drives us
+	if (!HitReact.IsValid())
+	{
+		const AActor* Owner = InAnimInstance ? InAnimInstance->GetOwningActor() : nullptr;
+		HitReact = Owner ? Owner->FindComponentByClass<UHitReact>() : nullptr;
+	}
+
+	// Copy the latest state while we're still on the game thread
+	if (const UHitReact* Component = HitReact.Get())
+	{
+		BoneRotations = Component->GetSpringBoneRotations();
+	}
+	else
+	{
+		BoneRotations.Reset();
+	}
+}
+
+bool FAnimNode_HitReactSpring::IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones)
+{
+	return BoneRotations.Num() > 0;
+}
+
+void FAnimNode_HitReactSpring::EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output,
+	TArray<FBoneTransform>& OutBoneTransforms)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FAnimNode_HitReactSpring::EvaluateSkeletalControl_AnyThread);
+
+	const FBoneContainer& BoneContainer = Output.Pose.GetPose().GetBoneContainer();
+
+	// Gather the bones to rotate, OutBoneTransforms must be sorted so parents come first
+	for (const auto& Pair : BoneRotations)
+	{
+		const int32 MeshBoneIndex = BoneContainer.GetPoseBoneIndexForBoneName(Pair.Key);
+		if (MeshBoneIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FCompactPoseBoneIndex BoneIndex = BoneContainer.MakeCompactPoseIndex(FMeshPoseBoneIndex(MeshBoneIndex));
+		if (BoneIndex.IsValid())
+		{
+			OutBoneTransforms.Emplace(BoneIndex, Output.Pose.GetComponentSpaceTransform(BoneIndex));
+		}
+	}
+	OutBoneTransforms.Sort(FCompareBoneTransformIndex());
+
+	// Rotate each bone about itself, carrying along any change made to a rotated ancestor
+	for (int32 i = 0; i < OutBoneTransforms.Num(); i++)
+	{
+		FBoneTransform& BoneTransform = OutBoneTransforms[i];
+		const FTransform InputTransform = BoneTransform.Transform;
+
+		// Find the closest ancestor that was rotated, they were all processed before us
+		for (FCompactPoseBoneIndex Parent = BoneContainer.GetParentBoneIndex(BoneTransform.BoneIndex);
+			Parent.IsValid(); Parent = BoneContainer.GetParentBoneIndex(Parent))
+		{
+			const FBoneTransform* Ancestor = OutBoneTransforms.FindByPredicate([Parent](const FBoneTransform& Other)
+			{
+				return Other.BoneIndex == Parent;
+			});
+			if (Ancestor)
+			{
+				const FTransform& AncestorInput = Output.Pose.GetComponentSpaceTransform(Parent);
+				BoneTransform.Transform = InputTransform.GetRelativeTransform(AncestorInput) * Ancestor->Transform;
+				break;
+			}
+		}
+
+		const FName BoneName = BoneContainer.GetReferenceSkeleton().GetBoneName(BoneContainer.MakeMeshPoseIndex(BoneTransform.BoneIndex).GetInt());
+		BoneTransform.Transform.SetRotation(BoneRotations.FindChecked(BoneName) * BoneTransform.Transform.GetRotation());
+	}
+}
@@ -5,14 +5,20 @@
 
 #include "HitReactProfile.h"
 #include "HitReactStatics.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/PhysicsConstraintTemplate.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
 #include "Misc/DataValidation.h"
 #include "PhysicsEngine/PhysicalAnimationComponent.h"
 #include "HAL/IConsoleManager.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "Logging/MessageLog.h"
+#include "GameFramework/GameStateBase.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
+#include "Net/UnrealNetwork.h"
 
 #if UE_ENABLE_DEBUG_DRAWING
 #include "Engine/Engine.h"  // GEngine
@@ -25,6 +31,12 @@
 #endif
 
 #include "HitReactBoneData.h"
+#include "System/HitReactNetRegistry.h"
+#include "System/HitReactLoadingSubsystem.h"
+#include "System/HitReactResidencySubsystem.h"
+#include "System/HitReactScheduler.h"
+#include "Misc/ScopeExit.h"
+#include "TimerManager.h"
 
 #if WITH_EDITOR
 #include "Framework/Notifications/NotificationManager.h"
@@ -99,8 +111,6 @@ namespace FHitReactCVars
 
 UHitReact::UHitReact(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
-	, bPhysicalAnimationProfileChanged(false)
-	, bConstraintProfileChanged(false)
 	, bCollisionEnabledChanged(false)
 	, DefaultCollisionEnabled(ECollisionEnabled::NoCollision)
 {
@@ -110,6 +120,8 @@ UHitReact::UHitReact(const FObjectInitializer& ObjectInitializer)
 	PrimaryComponentTick.TickGroup = TG_PrePhysics;
 
 	bAutoActivate = true;
+
+	ReplicatedEvents.OwnerComponent = this;
 }
 
 #if WITH_EDITOR
@@ -121,43 +133,196 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::HitReact);
 
-	// Avoid GC issues
-	if (!IsValid(GetOwner()))
+	// Constant-time rejections first, e.g. toggle and cooldown, without building any debug strings
+	const TCHAR* Rejection = nullptr;
+	if (!CanAdmitHitReact(&Rejection))
 	{
+		if (Rejection && ShouldDebugHitReactResult())
+		{
+			DebugHitReactResult(Rejection, true);
+		}
 		return false;
 	}
 
-	// Dedicated servers generally don't need cosmetic hit reacts
-	if (GetNetMode() == NM_DedicatedServer && !bApplyHitReactOnDedicatedServer)
+	// Requested by tag, e.g. by HitReactByTag or replicated from it
+	if (Params.ProfileTag.IsValid())
+	{
+		const TObjectPtr<const UHitReactProfile>* Profile = ProfilesByTag.Find(Params.ProfileTag);
+		if (!Profile)
+		{
+			if (ShouldDebugHitReactResult())
+			{
+				DebugHitReactResult(FString::Printf(TEXT("No available profile has the tag { %s }"), *Params.ProfileTag.ToString()), true);
+			}
+			return false;
+		}
+		return HitReactWithProfile(Params, *Profile, Impulse, World, ImpulseScalar);
+	}
+
+	// Null profile
+	if (Params.Profile.IsNull())
 	{
-		// DebugHitReactResult(TEXT("Dedicated server hit react disabled"), true);
+#if WITH_EDITOR
+		const FString Notify = FString::Printf(TEXT("Attempted to HitReact will null profile"));
+		if (!ConsumedNotifications.Contains(Notify))
+		{
+			ConsumedNotifications.Add(Notify);
+			FNotificationInfo Info(FText::FromString(Notify));
+			Info.ExpireDuration = 7.f;
+			FSlateNotificationManager::Get().AddNotification(Info);
+			return false;
+		}
+#endif
+		if (ShouldDebugHitReactResult())
+		{
+			DebugHitReactResult(TEXT("Null profile requested"), true);
+		}
 		return false;
 	}
-	
-	// Check if hit react is globally disabled
-	if (IsHitReactSystemDisabled())
-	{ 
+
+	// Ensure profile is loaded and available
+	const UHitReactProfile* Profile = FindActiveProfile(Params.Profile);
+	if (!Profile)
+	{
+#if WITH_EDITOR
+		// Only search the soft pointers once we know it's missing
+		if (!AvailableProfiles.Contains(Params.Profile))
+		{
+			const FString Notify = FString::Printf(TEXT("Profile not available, has not been added to UHitReact::AvailableProfiles { %s }"), *Params.Profile.ToString());
+			if (!ConsumedNotifications.Contains(Notify))
+			{
+				ConsumedNotifications.Add(Notify);
+				FNotificationInfo Info(FText::FromString(Notify));
+				Info.ExpireDuration = 7.f;
+				FSlateNotificationManager::Get().AddNotification(Info);
+				return false;
+			}
+		}
+#endif
+		if (ShouldDebugHitReactResult())
+		{
+			DebugHitReactResult(FString::Printf(TEXT("Requested profile { %s } is not available"), *Params.Profile.ToString()), true);
+		}
 		return false;
 	}
 
-	// Must have a valid mesh and owner
-	if (!Mesh || !IsValid(Mesh->GetOwner()))
+	return HitReactWithProfile(Params, Profile, Impulse, World, ImpulseScalar);
+}
+
+bool UHitReact::HitReactAtLocation(FVector WorldLocation, FVector Direction, const FHitReactInputParams& Params,
+	FHitReactImpulseParams Impulse, float ImpulseScalar)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::HitReactAtLocation);
+
+	// Admission is checked once, by HitReact
+	FHitReactInputParams LocationParams = Params;
+	LocationParams.SimulatedBoneName = FindNearestBody(WorldLocation);
+	if (LocationParams.SimulatedBoneName.IsNone())
 	{
-		DebugHitReactResult(TEXT("Invalid mesh or owner"), true);
+		DebugHitReactResult(TEXT("No body found near the hit location"), true);
 		return false;
 	}
 
-	// Extended runtime options
-	if (!CanHitReact())
+	FHitReactImpulse_WorldParams World;
+	World.LinearDirection = Direction.GetSafeNormal();
+	World.AngularDirection = World.LinearDirection;
+	World.RadialLocation = WorldLocation;
+
+	return HitReact(LocationParams, Impulse, World, ImpulseScalar);
+}
+
+FName UHitReact::FindNearestBody(FVector WorldLocation) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::FindNearestBody);
+
+	return UpdateBodyLookup() ? BodyLookup.FindNearest(WorldLocation) : NAME_None;
+}
+
+void UHitReact::FindNearestBodies(const TArray<FVector>& WorldLocations, TArray<FName>& BoneNames) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::FindNearestBodies);
+
+	if (!UpdateBodyLookup())
+	{
+		BoneNames.Init(NAME_None, WorldLocations.Num());
+		return;
+	}
+	BodyLookup.FindNearest(WorldLocations, BoneNames);
+}
+
+bool UHitReact::UpdateBodyLookup() const
+{
+	if (!Mesh)
 	{
-		DebugHitReactResult(TEXT("Hit react not allowed"), true);
 		return false;
 	}
 
-	// Must have profiles loaded (async)
-	if (!bProfilesLoaded)
+	// Built on first use so it costs nothing unless used, and rebuilt if the physics asset changes
+	if (!BodyLookup.IsBuiltFor(Mesh))
+	{
+		BodyLookup.Build(Mesh, BlacklistedBones);
+	}
+	return BodyLookup.Num() > 0;
+}
+
+bool UHitReact::HitReactByTag(FGameplayTag ProfileTag, const FHitReactInputParams& Params,
+	FHitReactImpulseParams Impulse, const FHitReactImpulse_WorldParams& World, float ImpulseScalar)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::HitReactByTag);
+
+	// HitReact resolves the tag, so that triggers replicate the tag instead of the profile
+	FHitReactInputParams TagParams = Params;
+	TagParams.ProfileTag = ProfileTag;
+	return HitReact(TagParams, Impulse, World, ImpulseScalar);
+}
+
+bool UHitReact::HitReactWithProfile(const FHitReactInputParams& Params, const UHitReactProfile* Profile,
+	const FHitReactImpulseParams& Impulse, const FHitReactImpulse_WorldParams& World, float ImpulseScalar)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::HitReactWithProfile);
+
+	// Hot paths read the compiled profile rather than the asset
+	const FHitReactCompiledProfile& Compiled = Profile->GetCompiled();
+	const TCHAR* Rejection = nullptr;
+
+	// Per-profile rejections, e.g. cooldown, LOD and max blends
+	EHitReactTier Tier = EHitReactTier::None;
+	if (!CanAdmitProfile(Profile, Tier, &Rejection))
+	{
+		if (Rejection && ShouldDebugHitReactResult())
+		{
+			DebugHitReactResult(FString::Printf(TEXT("%s for profile { %s }"), Rejection, *Profile->GetName()), true);
+		}
+		return false;
+	}
+
+	// Cull hit reacts nobody will see, before we validate further or modify the mesh
+	const EHitReactCullResponse CullResponse = GetCullResponse();
+	switch (CullResponse)
 	{
-		DebugHitReactResult(TEXT("Profiles not loaded"), true);
+	case EHitReactCullResponse::Apply:
+		break;
+	case EHitReactCullResponse::Defer:
+		DeferredHitReact.Params = Params;
+		DeferredHitReact.Params.Profile = Profile;  // Replay with the profile we resolved, e.g. by tag
+		DeferredHitReact.Params.ProfileTag = FGameplayTag();
+		DeferredHitReact.Impulse = Impulse;
+		DeferredHitReact.World = World;
+		DeferredHitReact.ImpulseScalar = ImpulseScalar;
+		DeferredHitReact.Time = GetWorld()->GetTimeSeconds();
+		WakeHitReact();
+		DebugHitReactResult(TEXT("Culled, deferred until rendered"), false);
+		return false;
+	case EHitReactCullResponse::ImpulseOnly:
+		// Nothing is simulating, so there is nothing to push
+		if (PhysicsBlends.Num() == 0 || !Impulse.CanBeApplied())
+		{
+			DebugHitReactResult(TEXT("Culled, no simulated bodies for impulse"), false);
+			return false;
+		}
+		break;
+	case EHitReactCullResponse::Drop:
+		DebugHitReactResult(TEXT("Culled"), false);
 		return false;
 	}
 
@@ -175,75 +340,32 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 		return false;
 	}
 
-	// Conditionally override the collision enabled state
-	if (NeedsCollisionEnabled())
+	// Bones may arrive from the network, they must exist on this mesh
+	if (!Params.SimulatedBoneName.IsNone() && Mesh->GetBoneIndex(Params.SimulatedBoneName) == INDEX_NONE)
 	{
-		bCollisionEnabledChanged = true;
-		DefaultCollisionEnabled = Mesh->GetCollisionEnabled();
-		switch (DefaultCollisionEnabled)
+		if (ShouldDebugHitReactResult())
 		{
-		case ECollisionEnabled::NoCollision:
-		case ECollisionEnabled::ProbeOnly:
-			Mesh->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
-			break;
-		case ECollisionEnabled::QueryOnly:
-		case ECollisionEnabled::QueryAndProbe:
-			Mesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-			break;
-		default: break;
+			DebugHitReactResult(FString::Printf(TEXT("Simulated bone { %s } does not exist on mesh"), *Params.SimulatedBoneName.ToString()), true);
 		}
-	}
-
-	// If physics state is invalid - i.e. collision is disabled - or it does not have a valid bodies, this will crash right away
-	// Since we have done our checks and updated collision this shouldn't really be false
-	if (UNLIKELY(!Mesh->IsPhysicsStateCreated() || !Mesh->bHasValidBodies))
-	{
-		DebugHitReactResult(TEXT("Invalid Bodies"), true);
 		return false;
 	}
-
-	if (Params.Profile.IsNull())
+	if (!Params.ImpulseBoneName.IsNone() && Mesh->GetBoneIndex(Params.ImpulseBoneName) == INDEX_NONE)
 	{
-#if WITH_EDITOR
-		const FString Notify = FString::Printf(TEXT("Attempted to HitReact will null profile"));
-		if (!ConsumedNotifications.Contains(Notify))
+		if (ShouldDebugHitReactResult())
 		{
-			ConsumedNotifications.Add(Notify);
-			FNotificationInfo Info(FText::FromString(Notify));
-			Info.ExpireDuration = 7.f;
-			FSlateNotificationManager::Get().AddNotification(Info);
-			return false;
+			DebugHitReactResult(FString::Printf(TEXT("Impulse bone { %s } does not exist on mesh"), *Params.ImpulseBoneName.ToString()), true);
 		}
-#endif
-		DebugHitReactResult(TEXT("Null profile requested"), true);
 		return false;
 	}
 
-#if WITH_EDITOR
-	if (!AvailableProfiles.Contains(Params.Profile))
+	// Invalid blend params -- total time is zero
+	if (!FHitReactPhysicsState::CanActivate(Compiled.BlendParams))
 	{
-		const FString Notify = FString::Printf(TEXT("Profile not available, has not been added to UHitReact::AvailableProfiles { %s }"), *Params.Profile.ToString());
-		if (!ConsumedNotifications.Contains(Notify))
+		if (ShouldDebugHitReactResult())
 		{
-			ConsumedNotifications.Add(Notify);
-			FNotificationInfo Info(FText::FromString(Notify));
-			Info.ExpireDuration = 7.f;
-			FSlateNotificationManager::Get().AddNotification(Info);
-			return false;
+			DebugHitReactResult(FString::Printf(TEXT("Blend params for profile { %s } are invalid"), *Profile->GetName()), true);
 		}
-	}
-#endif
-
-	// Ensure profile is loaded and available
-	TObjectPtr<const UHitReactProfile> Profile = nullptr;
-	if (Params.Profile.IsValid())
-	{
-		const TObjectPtr<const UHitReactProfile>* ProfilePtr = ActiveProfiles.FindByPredicate([&Params](const TObjectPtr<const UHitReactProfile>& InProfile)
-		{
-			return InProfile == Params.Profile.Get();
-		});
-
-		Profile = ProfilePtr ? *ProfilePtr : nullptr;
+		return false;
 	}
 
 	// Ensure bone data is loaded and available
@@ -267,121 +389,132 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 		BoneData = BoneDataPtr ? *BoneDataPtr : nullptr;
 	}
 
-	// No valid profile found
-	if (!Profile)
-	{
-		DebugHitReactResult(FString::Printf(TEXT("Requested profile { %s } is not available"), *Params.Profile.ToString()), true);
-		return false;
-	}
+	// Catch up on any hold sleep before we rank, evict or add blends, otherwise new blends would skip the time we slept
+	WakeHitReact();
 
-	// Invalid blend params -- total time is zero
-	if (!FHitReactPhysicsState::CanActivate(Profile->BlendParams))
-	{
-		DebugHitReactResult(FString::Printf(TEXT("Blend params for profile { %s } are invalid"), *Params.Profile.ToString()), true);
-		return false;
-	}
+	float& LastProfileTime = LastProfileHitReactTimes.FindOrAdd(Profile);
+	const FHitReactChannel* Channel = Channels.Find(Compiled.Channel);
+	float* LastChannelTime = Channel ? &LastChannelHitReactTimes.FindOrAdd(Compiled.Channel) : nullptr;
 
-	// Don't apply hit react if the LOD threshold is not met
-	if (Profile->LODThreshold >= 0)
+	// Approximate the hit react with a spring, the mesh's physics state is not touched
+	if (Tier == EHitReactTier::Spring)
 	{
-		if (Mesh->GetPredictedLODLevel() > Profile->LODThreshold)
+		if (!HitReactSpring(Params, Impulse, World, ImpulseScalar, Profile))
 		{
-			DebugHitReactResult(FString::Printf(TEXT("LOD threshold not met for profile { %s }"), *Params.Profile.ToString()), true);
+			DebugHitReactResult(TEXT("Spring hit react failed to apply"), true);
 			return false;
 		}
+
+		// Track the last hit react time
+		LastHitReactTime = GetWorld()->GetTimeSeconds();
+		LastProfileTime = LastHitReactTime;
+		if (LastChannelTime) { *LastChannelTime = LastHitReactTime; }
+
+		DebugHitReactResult(TEXT("Spring hit react applied"), false);
+		return true;
 	}
 
-	// Throttle hit reacts to prevent rapid application
-	if (Cooldown > 0.f && LastHitReactTime >= 0.f)
+	// Conditionally override the collision enabled state
+	if (Backend == EHitReactBackend::Physics && CullResponse != EHitReactCullResponse::ImpulseOnly)
 	{
-		if (GetWorld()->TimeSince(LastHitReactTime) < Cooldown)
-		{
-			return false;
-		}
+		MakePhysicsResident();
 	}
 
-	// Throttle hit reacts to prevent rapid application also for the profile
-	float& LastProfileTime = LastProfileHitReactTimes.FindOrAdd(Profile);
-	if (Profile->Cooldown > 0.f)
+	// If physics state is invalid - i.e. collision is disabled - or it does not have a valid bodies, this will crash right away
+	// Since we have done our checks and updated collision this shouldn't really be false
+	// The AnimNode backend doesn't use the mesh's bodies
+	if (Backend == EHitReactBackend::Physics && UNLIKELY(!Mesh->IsPhysicsStateCreated() || !Mesh->bHasValidBodies))
 	{
-		if (GetWorld()->TimeSince(LastProfileTime) < Profile->Cooldown)
-		{
-			return false;
-		}
+		DebugHitReactResult(TEXT("Invalid Bodies"), true);
+		return false;
 	}
 
-	// Apply the constraint profile to the mesh
-	if (!Profile->ConstraintProfile.IsNone())
+	// Culled to impulse only, push the bodies that are already simulating without starting a new blend
+	if (CullResponse == EHitReactCullResponse::ImpulseOnly)
 	{
-		bConstraintProfileChanged = true;
-		Mesh->SetConstraintProfileForAll(Profile->ConstraintProfile);
+		const FName ImpulseBoneName = Params.ImpulseBoneName.IsNone() ? Params.SimulatedBoneName : Params.ImpulseBoneName;
+		PendingImpulse = FHitReactPendingImpulse{ Impulse, World, ImpulseScalar, Profile, ImpulseBoneName };
+		WakeHitReact();  // The impulse is applied on our next tick
+
+		// Track the last hit react time
+		LastHitReactTime = GetWorld()->GetTimeSeconds();
+		LastProfileTime = LastHitReactTime;
+		if (LastChannelTime) { *LastChannelTime = LastHitReactTime; }
+
+		DebugHitReactResult(TEXT("Culled, applied impulse only"), false);
+		return true;
 	}
-		
+
 	// Optionally don't apply hit react if we have reached the maximum number of active hit reacts
-	switch (Profile->MaxBlendHandling)
+	// The channel's and component's budgets apply on top of the profile's
+	const bool bProfileOverBudget = Compiled.MaxBlendHandling != EHitReactMaxBlendHandling::Disabled &&
+		GetProfileBlendCount(Compiled) >= Compiled.MaxActiveBlends;
+	const bool bChannelOverBudget = Channel && IsChannelOverBudget(Compiled.Channel, *Channel);
+	const bool bBodiesOverBudget = MaxSimulatedBodies > 0 && GetSimulatedBodyCount() >= MaxSimulatedBodies;
+
+	// Blocked budgets were rejected by CanAdmitProfile
+	const TCHAR* ImpulseOnlyResult = nullptr;
+	if (bProfileOverBudget && Compiled.MaxBlendHandling == EHitReactMaxBlendHandling::ImpulseOnly)
 	{
-	case EHitReactMaxBlendHandling::Disabled:
-		break;
-	case EHitReactMaxBlendHandling::ImpulseOnly:
-		if (PhysicsBlends.Num() >= Profile->MaxActiveBlends)
+		ImpulseOnlyResult = TEXT("Applied impulse only");
+	}
+	else if (bChannelOverBudget && Channel->MaxBlendHandling == EHitReactMaxBlendHandling::ImpulseOnly)
+	{
+		ImpulseOnlyResult = TEXT("Channel over budget, applied impulse only");
+	}
+	else if (bBodiesOverBudget && MaxSimulatedBodiesHandling == EHitReactMaxBlendHandling::ImpulseOnly)
+	{
+		ImpulseOnlyResult = TEXT("Too many simulated bodies, applied impulse only");
+	}
+
+	if (ImpulseOnlyResult)
+	{
+		// Apply physics impulse on next tick
+		if (Impulse.CanBeApplied())
 		{
-			// Apply physics impulse on next tick
-			if (Impulse.CanBeApplied())
-			{
-				FName ImpulseBoneName = Params.ImpulseBoneName.IsNone() ? Params.SimulatedBoneName : Params.ImpulseBoneName;
-				PendingImpulse = FHitReactPendingImpulse{ Impulse, World, ImpulseScalar, Profile, ImpulseBoneName };
-			}
+			FName ImpulseBoneName = Params.ImpulseBoneName.IsNone() ? Params.SimulatedBoneName : Params.ImpulseBoneName;
+			PendingImpulse = FHitReactPendingImpulse{ Impulse, World, ImpulseScalar, Profile, ImpulseBoneName };
+			WakeHitReact();  // The impulse is applied on our next tick
+		}
 
-			// Track the last hit react time
-			LastHitReactTime = GetWorld()->GetTimeSeconds();
-			LastProfileTime = LastHitReactTime;
+		// Track the last hit react time
+		LastHitReactTime = GetWorld()->GetTimeSeconds();
+		LastProfileTime = LastHitReactTime;
+		if (LastChannelTime) { *LastChannelTime = LastHitReactTime; }
 
-			// Print the result
-			DebugHitReactResult(TEXT("Applied impulse only"), false);
+		// Print the result
+		DebugHitReactResult(ImpulseOnlyResult, false);
 			
-			return true;  // Not sure what to return here, but this seems to be the most appropriate
-		}
-		break;
-	case EHitReactMaxBlendHandling::Blocked:
-		if (PhysicsBlends.Num() >= Profile->MaxActiveBlends)
-		{
-			return false;
-		}
-		break;
+		return true;  // Not sure what to return here, but this seems to be the most appropriate
+	}
+
+	// Fade out the lowest ranked blends to make room
+	if (bProfileOverBudget && Compiled.MaxBlendHandling == EHitReactMaxBlendHandling::Evict)
+	{
+		const FGameplayTag* EvictChannel = Channel ? &Compiled.Channel : nullptr;
+		while (GetProfileBlendCount(Compiled) >= Compiled.MaxActiveBlends && EvictPhysicsBlend(Compiled.Eviction, EvictChannel)) {}
+	}
+	if (bChannelOverBudget && Channel->MaxBlendHandling == EHitReactMaxBlendHandling::Evict)
+	{
+		while (IsChannelOverBudget(Compiled.Channel, *Channel) && EvictPhysicsBlend(Channel->Eviction, &Compiled.Channel)) {}
+	}
+	if (bBodiesOverBudget && MaxSimulatedBodiesHandling == EHitReactMaxBlendHandling::Evict)
+	{
+		while (GetSimulatedBodyCount() >= MaxSimulatedBodies && EvictPhysicsBlend(Eviction)) {}
 	}
 
 	// Gather disabled bones and their descendents
 	TArray<FName> DisabledBones = {};
 	TMap<FName, float> BoneWeightScalars = {};
-	TMap<FName, FHitReactBoneOverride> BoneOverrides = Profile->BoneOverrides;
-	if (BoneData)
-	{
-		// Append BoneOverrides with optional BoneData overrides
-		for (const auto& Pair : BoneData->BoneOverrides)
-		{
-			// If an override exists already, take the higher BlendWeightScalar, and if either disables physics, disable physics
-			const FName& BoneName = Pair.Key;
-			const FHitReactBoneOverride& Override = Pair.Value;
-			FHitReactBoneOverride& ExistingOverride = BoneOverrides.FindOrAdd(BoneName);
-			if (Override.bDisablePhysics)
-			{
-				ExistingOverride.bDisablePhysics = true;
-			}
-			ExistingOverride.BlendWeightScalar = FMath::Max(ExistingOverride.BlendWeightScalar, Override.BlendWeightScalar);
-		}
-	}
-	for (const auto& Pair : BoneOverrides)
+	const auto ApplyBoneOverride = [this, &DisabledBones, &BoneWeightScalars](const FName& BoneName,
+		const FHitReactBoneOverride& Override)
 	{
-		const FName& BoneName = Pair.Key;
-		const FHitReactBoneOverride& Override = Pair.Value;
 		if (Override.bDisablePhysics || Override.BlendWeightScalar < 1.f)
 		{
 			// Iterate all descendents
-			UHitReactStatics::ForEach(Mesh, BoneName, Override.bIncludeSelf,
-				[this, &Override, &DisabledBones, &BoneWeightScalars](const FBodyInstance* BI)
+			ForEachBone(BoneName, Override.bIncludeSelf,
+				[&Override, &DisabledBones, &BoneWeightScalars](const FName& ChildBoneName)
 			{
-				const FName ChildBoneName = UHitReactStatics::GetBoneName(Mesh, BI);
-					
 				// Disable all descendents
 				if (Override.bDisablePhysics)
 				{
@@ -398,25 +531,55 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 				return true;
 			});
 		}
+	};
+
+	if (BoneData && BoneData->BoneOverrides.Num() > 0)
+	{
+		// Merge the optional BoneData overrides with the profile's BoneOverrides
+		TMap<FName, FHitReactBoneOverride> BoneOverrides;
+		BoneOverrides.Reserve(Compiled.BoneOverrides.Num() + BoneData->BoneOverrides.Num());
+		for (const TPair<FName, FHitReactBoneOverride>& Override : Compiled.BoneOverrides)
+		{
+			BoneOverrides.Add(Override.Key, Override.Value);
+		}
+		for (const auto& Pair : BoneData->BoneOverrides)
+		{
+			// If an override exists already, take the higher BlendWeightScalar, and if either disables physics, disable physics
+			const FName& BoneName = Pair.Key;
+			const FHitReactBoneOverride& Override = Pair.Value;
+			FHitReactBoneOverride& ExistingOverride = BoneOverrides.FindOrAdd(BoneName);
+			if (Override.bDisablePhysics)
+			{
+				ExistingOverride.bDisablePhysics = true;
+			}
+			ExistingOverride.BlendWeightScalar = FMath::Max(ExistingOverride.BlendWeightScalar, Override.BlendWeightScalar);
+		}
+		for (const auto& Pair : BoneOverrides)
+		{
+			ApplyBoneOverride(Pair.Key, Pair.Value);
+		}
+	}
+	else
+	{
+		// Nothing to merge, read the compiled overrides directly
+		for (const TPair<FName, FHitReactBoneOverride>& Override : Compiled.BoneOverrides)
+		{
+			ApplyBoneOverride(Override.Key, Override.Value);
+		}
 	}
 
 	// Apply the hit react to the first bone below the specified bone that is valid
 	bool bApplied = false;
 	bool bAppliedProfile = false;
-	FName StartingBone = Params.SimulatedBoneName;  // First bone that was valid and applied to
-	if (const FName* RemapBoneName = Profile->RemapSimulatedBones.Find(StartingBone))
-	{
-		// Remap the bone name --
-		// Params.bIncludeSelf isn't handled, we might not always want the same value, not sure how to handle that here
-		StartingBone = *RemapBoneName;
-	}
+	// Remap the bone name --
+	// Params.bIncludeSelf isn't handled, we might not always want the same value, not sure how to handle that here
+	const FName StartingBone = Compiled.RemapSimulatedBone(Params.SimulatedBoneName);
 	FName SimulatedBoneName = NAME_None;  // First bone that was valid and applied to
-	UHitReactStatics::ForEach(Mesh, StartingBone, Params.bIncludeSelf,
-		[this, &Profile, &bAppliedProfile, &Params, &bApplied, &DisabledBones, &BoneWeightScalars, &SimulatedBoneName]
-		(const FBodyInstance* BI)
+	ForEachBone(StartingBone, Params.bIncludeSelf,
+		[this, &Profile, &Compiled, &bAppliedProfile, &Params, &bApplied, &DisabledBones, &BoneWeightScalars, &SimulatedBoneName]
+		(const FName& BoneName)
 	{
 		// Determine the bone name to Simulate
-		const FName BoneName = UHitReactStatics::GetBoneName(Mesh, BI);
 		if (BlacklistedBones.Contains(BoneName))
 		{
 			// Don't simulate this bone
@@ -430,14 +593,17 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 			return true;  // Continue to the next bone
 		}
 
-		// Apply the animation profile to the first valid bone
+		// Apply the constraint and animation profiles to the first valid bone
 		if (!bAppliedProfile)
 		{
 			bAppliedProfile = true;
-			if (PhysicalAnimation && !Profile->PhysicalAnimProfile.IsNone())
+			if (Backend == EHitReactBackend::Physics && !Compiled.ConstraintProfile.IsNone())
+			{
+				ApplyConstraintProfileBelow(BoneName, Params.bIncludeSelf, Compiled.ConstraintProfile);
+			}
+			if (Backend == EHitReactBackend::Physics && PhysicalAnimation && !Compiled.PhysicalAnimProfile.IsNone())
 			{
-				bPhysicalAnimationProfileChanged = true;
-				PhysicalAnimation->ApplyPhysicalAnimationProfileBelow(BoneName, Profile->PhysicalAnimProfile, Params.bIncludeSelf);
+				ApplyPhysicalAnimProfileBelow(BoneName, Params.bIncludeSelf, Compiled.PhysicalAnimProfile);
 			}
 		}
 
@@ -446,7 +612,17 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 
 		// Apply the hit react to the bone
 		FHitReactPhysics& Physics = PhysicsBlends.Add_GetRef({});
-		Physics.HitReact(Mesh, Profile, BoneName, DisabledBones, BoneWeightScalars);
+		Physics.HitReact(Mesh, Profile, BoneName, DisabledBones, BoneWeightScalars, PhysicsBlendTime);
+
+		// Count the bodies against the channel's and component's budgets
+		ForEachBone(BoneName, true, [&Physics, &DisabledBones](const FName& ChildBoneName)
+		{
+			if (!DisabledBones.Contains(ChildBoneName))
+			{
+				Physics.NumSimulatedBodies++;
+			}
+			return true;  // Continue to the next bone
+		});
 
 		// Output the resulting bone
 		bApplied = true;
@@ -478,6 +654,7 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 		// Track the last hit react time
 		LastHitReactTime = GetWorld()->GetTimeSeconds();
 		LastProfileTime = LastHitReactTime;
+		if (LastChannelTime) { *LastChannelTime = LastHitReactTime; }
 	}
 	
 	// Print the result
@@ -486,10 +663,260 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 	return bApplied;
 }
 
-bool UHitReact::HitReactTrigger(const FHitReactTrigger& Params, const FHitReactImpulse_WorldParams& World,
-	float ImpulseScalar)
+bool UHitReact::CanHitReactWith(const FHitReactInputParams& Params) const
 {
-	return HitReact(Params, Params.Impulse, World, ImpulseScalar);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::CanHitReactWith);
+
+	if (!CanAdmitHitReact())
+	{
+		return false;
+	}
+
+	const TObjectPtr<const UHitReactProfile>* TaggedProfile = Params.ProfileTag.IsValid() ? ProfilesByTag.Find(Params.ProfileTag) : nullptr;
+	const UHitReactProfile* Profile = Params.ProfileTag.IsValid() ? (TaggedProfile ? TaggedProfile->Get() : nullptr) : FindActiveProfile(Params.Profile);
+	EHitReactTier Tier = EHitReactTier::None;
+	return Profile && CanAdmitProfile(Profile, Tier);
+}
+
+bool UHitReact::CanAdmitHitReact(const TCHAR** OutRejection) const
+{
+	// Avoid GC issues
+	if (!IsValid(GetOwner()))
+	{
+		return false;
+	}
+
+	// Dedicated servers generally don't need cosmetic hit reacts
+	if (GetNetMode() == NM_DedicatedServer && !bApplyHitReactOnDedicatedServer)
+	{
+		return false;
+	}
+
+	// Check if hit react is globally disabled
+	if (IsHitReactSystemDisabled())
+	{
+		return false;
+	}
+
+	// Throttle hit reacts to prevent rapid application
+	if (Cooldown > 0.f && LastHitReactTime >= 0.f && GetWorld()->TimeSince(LastHitReactTime) < Cooldown)
+	{
+		return false;
+	}
+
+	// Must have a valid mesh and owner
+	if (!Mesh || !IsValid(Mesh->GetOwner()))
+	{
+		if (OutRejection) { *OutRejection = TEXT("Invalid mesh or owner"); }
+		return false;
+	}
+
+	// Must have profiles loaded (async)
+	if (!bProfilesLoaded)
+	{
+		if (OutRejection) { *OutRejection = TEXT("Profiles not loaded"); }
+		return false;
+	}
+
+	// Extended runtime options, last because it may be implemented in blueprint
+	if (!CanHitReact())
+	{
+		if (OutRejection) { *OutRejection = TEXT("Hit react not allowed"); }
+		return false;
+	}
+
+	return true;
+}
+
+bool UHitReact::CanAdmitProfile(const UHitReactProfile* Profile, EHitReactTier& OutTier, const TCHAR** OutRejection) const
+{
+	const FHitReactCompiledProfile& Compiled = Profile->GetCompiled();
+
+	// Throttle hit reacts to prevent rapid application also for the profile
+	if (Compiled.Cooldown > 0.f)
+	{
+		const float* LastProfileTime = LastProfileHitReactTimes.Find(Profile);
+		if (LastProfileTime && GetWorld()->TimeSince(*LastProfileTime) < Compiled.Cooldown)
+		{
+			return false;
+		}
+	}
+
+	// Throttle hit reacts to prevent rapid application also for the channel
+	const FHitReactChannel* Channel = Channels.Find(Compiled.Channel);
+	if (Channel && Channel->Cooldown > 0.f)
+	{
+		const float* LastChannelTime = LastChannelHitReactTimes.Find(Compiled.Channel);
+		if (LastChannelTime && GetWorld()->TimeSince(*LastChannelTime) < Channel->Cooldown)
+		{
+			return false;
+		}
+	}
+
+	// Don't apply hit react if the LOD threshold is not met, unless the profile falls back to a spring
+	OutTier = GetHitReactTier(Profile);
+	if (OutTier == EHitReactTier::None)
+	{
+		if (OutRejection) { *OutRejection = TEXT("LOD threshold not met"); }
+		return false;
+	}
+
+	// Optionally block the hit react if we have reached the maximum number of active hit reacts, springs don't count
+	if (OutTier == EHitReactTier::Full && Compiled.MaxBlendHandling == EHitReactMaxBlendHandling::Blocked &&
+		GetProfileBlendCount(Compiled) >= Compiled.MaxActiveBlends)
+	{
+		return false;
+	}
+
+	// Optionally block the hit react if we are simulating too many bodies
+	if (OutTier == EHitReactTier::Full && MaxSimulatedBodiesHandling == EHitReactMaxBlendHandling::Blocked &&
+		MaxSimulatedBodies > 0 && GetSimulatedBodyCount() >= MaxSimulatedBodies)
+	{
+		return false;
+	}
+
+	// Optionally block the hit react if its channel is over budget
+	if (OutTier == EHitReactTier::Full && Channel && Channel->MaxBlendHandling == EHitReactMaxBlendHandling::Blocked &&
+		IsChannelOverBudget(Compiled.Channel, *Channel))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool UHitReact::IsChannelOverBudget(const FGameplayTag& Channel, const FHitReactChannel& ChannelParams) const
+{
+	if (ChannelParams.MaxActiveBlends > 0 && GetChannelBlendCount(Channel) >= ChannelParams.MaxActiveBlends)
+	{
+		return true;
+	}
+	if (ChannelParams.MaxSimulatedBodies > 0 && GetChannelBodyCount(Channel) >= ChannelParams.MaxSimulatedBodies)
+	{
+		return true;
+	}
+	return false;
+}
+
+int32 UHitReact::GetNumAdmittedBlends() const
+{
+	int32 NumBlends = 0;
+	for (const FHitReactPhysics& Physics : PhysicsBlends)
+	{
+		if (!Physics.bEvicted)
+		{
+			NumBlends++;
+		}
+	}
+	return NumBlends;
+}
+
+int32 UHitReact::GetProfileBlendCount(const FHitReactCompiledProfile& Compiled) const
+{
+	// A configured channel is the profile's budget, so blends from other channels can't crowd it out
+	return Channels.Contains(Compiled.Channel) ? GetChannelBlendCount(Compiled.Channel) : GetNumAdmittedBlends();
+}
+
+int32 UHitReact::GetSimulatedBodyCount() const
+{
+	int32 NumBodies = 0;
+	for (const FHitReactPhysics& Physics : PhysicsBlends)
+	{
+		if (!Physics.bEvicted)
+		{
+			NumBodies += Physics.NumSimulatedBodies;
+		}
+	}
+	return NumBodies;
+}
+
+bool UHitReact::EvictPhysicsBlend(const FHitReactEviction& EvictionParams, const FGameplayTag* Channel)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::EvictPhysicsBlend);
+
+	// Find the lowest ranked blend that isn't already fading out
+	FHitReactPhysics* Evictee = nullptr;
+	float EvicteeRank = TNumericLimits<float>::Max();
+	for (FHitReactPhysics& Physics : PhysicsBlends)
+	{
+		if (Physics.bEvicted || !Physics.IsActive())
+		{
+			continue;
+		}
+		if (Channel && (!Physics.CompiledProfile || Physics.CompiledProfile->Channel != *Channel))
+		{
+			continue;
+		}
+
+		const FHitReactPhysicsState& State = Physics.PhysicsState;
+		const float Rank = EvictionParams.Ranking == EHitReactEvictionRanking::Weakest ? Physics.RequestedBlendWeight :
+			State.GetCompletionTime() - State.GetEvaluatedTime();
+		if (Rank < EvicteeRank)
+		{
+			Evictee = &Physics;
+			EvicteeRank = Rank;
+		}
+	}
+
+	if (!Evictee)
+	{
+		return false;
+	}
+
+	// Console command: Log LogHitReact VeryVerbose
+	UE_LOG(LogHitReact, VeryVerbose, TEXT("Evicting bone %s"), *Evictee->SimulatedBoneName.ToString());
+
+	Evictee->Evict(EvictionParams.FadeTime);
+	return true;
+}
+
+int32 UHitReact::GetChannelBlendCount(FGameplayTag Channel) const
+{
+	int32 NumBlends = 0;
+	for (const FHitReactPhysics& Physics : PhysicsBlends)
+	{
+		if (!Physics.bEvicted && Physics.CompiledProfile && Physics.CompiledProfile->Channel == Channel)
+		{
+			NumBlends++;
+		}
+	}
+	return NumBlends;
+}
+
+int32 UHitReact::GetChannelBodyCount(FGameplayTag Channel) const
+{
+	int32 NumBodies = 0;
+	for (const FHitReactPhysics& Physics : PhysicsBlends)
+	{
+		if (!Physics.bEvicted && Physics.CompiledProfile && Physics.CompiledProfile->Channel == Channel)
+		{
+			NumBodies += Physics.NumSimulatedBodies;
+		}
+	}
+	return NumBodies;
+}
+
+const UHitReactProfile* UHitReact::FindActiveProfile(const TSoftObjectPtr<UHitReactProfile>& Profile) const
+{
+	// Only resolves if already loaded, never loads
+	const UHitReactProfile* LoadedProfile = Profile.Get();
+	if (!LoadedProfile)
+	{
+		return nullptr;
+	}
+
+	const TObjectPtr<const UHitReactProfile>* ProfilePtr = ActiveProfiles.FindByPredicate(
+		[LoadedProfile](const TObjectPtr<const UHitReactProfile>& InProfile)
+	{
+		return InProfile == LoadedProfile;
+	});
+	return ProfilePtr ? ProfilePtr->Get() : nullptr;
+}
+
+bool UHitReact::HitReactTrigger(const FHitReactTrigger& Params, const FHitReactImpulse_WorldParams& World,
+	float ImpulseScalar)
+{
+	return HitReact(Params, Params.Impulse, World, ImpulseScalar);
 }
 
 bool UHitReact::HitReactTrigger_Linear(const FHitReactTrigger_Linear& Params, const FHitReactImpulse_WorldParams& World,
@@ -516,6 +943,48 @@ bool UHitReact::HitReactTrigger_Radial(const FHitReactTrigger_Radial& Params, co
 	return HitReact(Params, ImpulseParams, World, ImpulseScalar);
 }
 
+void UHitReact::ReplicateHitReact(const FHitReactTrigger& Params, const FHitReactImpulse_WorldParams& World,
+	float ImpulseScalar)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ReplicateHitReact);
+
+	if (!GetWorld() || !GetOwner() || !GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	// Write to the buffer, clients will apply it when it replicates
+	if (bReplicateHitReactEvents && GetIsReplicated())
+	{
+		ReplicatedEvents.AddEvent(Params, World, ImpulseScalar, GetWorld()->GetTimeSeconds(), MaxReplicatedEvents,
+			ReplicatedEventCoalesceWindow);
+	}
+
+	// Apply locally, HitReact() handles dedicated servers
+	HitReactTrigger(Params, World, ImpulseScalar);
+}
+
+void UHitReact::OnReplicatedHitReactEvent(const FHitReactEventItem& Event)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::OnReplicatedHitReactEvent);
+
+	// The server already applied it
+	if (!GetWorld() || !GetOwner() || GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	// Skip stale events, e.g. the initial state received when joining late or becoming relevant
+	const AGameStateBase* GameState = GetWorld()->GetGameState();
+	const float ServerTime = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+	if (ServerTime - Event.ServerTime > ReplicatedEventStaleTime)
+	{
+		return;
+	}
+
+	HitReactTrigger(Event.Trigger, Event.World, Event.ImpulseScalar);
+}
+
 void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::TickComponent);
@@ -528,11 +997,40 @@ void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorC
 		ResetHitReactSystem();
 		SleepHitReact();
 		PendingImpulse = {};
+		DeferredHitReact = {};
+		return;
+	}
+
+	// Take turns with other components, catching up on the time we skipped when it is our turn
+	UHitReactScheduler* Scheduler = GetWorld()->GetSubsystem<UHitReactScheduler>();
+	if (Scheduler && !Scheduler->ShouldUpdate(this, ShouldUpdateEveryFrame(), FramesSinceUpdate))
+	{
+		TimeSlicedDeltaTime += DeltaTime;
+		FramesSinceUpdate++;
 		return;
 	}
+	DeltaTime += TimeSlicedDeltaTime;
+	TimeSlicedDeltaTime = 0.f;
+	FramesSinceUpdate = 0;
+
+	// Count our update against the scheduler's frame budget
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	ON_SCOPE_EXIT
+	{
+		if (Scheduler)
+		{
+			Scheduler->ReportUpdateTime(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0);
+		}
+	};
 
 	// Tick the global toggle state
 	TickGlobalToggle(DeltaTime);
+
+	// Apply any hit react that was waiting to be seen
+	TickDeferredHitReact();
+
+	// Physics-free hit reacts beyond the LOD threshold
+	TickSprings(DeltaTime);
 	
 	if (PhysicsBlends.Num() == 0)
 	{
@@ -558,106 +1056,122 @@ void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorC
 	FString DebugBoneWeightString = "";
 #endif
 
-	// Accumulate final blend weights per bone
-	TMap<FName, float> AccumulatedBoneWeights;
+	// Not rendered, only advance the blends, and evaluate the bone weights once we're rendered again
+	if (ShouldSkipBoneWeights())
+	{
+		AdvancePhysicsBlends(DeltaTime);
+		bSkippedBoneWeights = true;
+		if (PhysicsBlends.Num() > 0)
+		{
+			if (PendingImpulse.IsValid())
+			{
+				ApplyImpulse(PendingImpulse);
+				PendingImpulse = {};
+			}
+			return;
+		}
+		// Completed while not rendered, catch up to zero the bones we were driving, then continue to restore the mesh
+	}
+	if (bSkippedBoneWeights)
+	{
+		CatchUpBoneWeights();
+	}
 
-	// Scale the blend rate by the global alpha
-	const float GlobalAlpha = GlobalToggle.State.GetBlendStateAlpha();
+	// Step the blends at a fixed rate if desired, so hitches and high frame rates don't change the result
+	float InterpAlpha = 1.f;
+	if (bUseFixedSimulationRate)
+	{
+		const float StepTime = 1.f / FMath::Max(1.f, SimulationRate);
+		SimulationTimeAccumulator += DeltaTime;
+		int32 NumSteps = FMath::FloorToInt32(SimulationTimeAccumulator / StepTime);
+		if (NumSteps > MaxSubsteps)
+		{
+			// Drop the steps we can't afford to simulate, rather than spiralling
+			NumSteps = FMath::Max(1, MaxSubsteps);
+			const float KeptTime = NumSteps * StepTime + FMath::Fmod(SimulationTimeAccumulator, StepTime);
 
-	// Average the blend rates of each profile
-	float BoneBlendRate = 0.f;
-	for (const FHitReactPhysics& Physics : PhysicsBlends)
+			// The blends still age by the dropped time, including time skipped while time sliced, only the weight smoothing loses it
+			PhysicsBlendTime += SimulationTimeAccumulator - KeptTime;
+			SimulationTimeAccumulator = KeptTime;
+		}
+
+		for (int32 Step = 0; Step < NumSteps; Step++)
+		{
+			StepPhysicsBlends(StepTime);
+		}
+
+		SimulationTimeAccumulator -= NumSteps * StepTime;
+		InterpAlpha = FMath::Clamp(SimulationTimeAccumulator / StepTime, 0.f, 1.f);
+	}
+	else
 	{
-		BoneBlendRate += Physics.Profile->BoneBlendRate;
+		StepPhysicsBlends(DeltaTime);
 	}
-	BoneBlendRate /= FMath::Max(1, PhysicsBlends.Num());
 
-	// Tick each physics blend and accumulate the blend weights
-	PhysicsBlends.RemoveAll([this, DeltaTime, &GlobalAlpha, &AccumulatedBoneWeights, &BoneBlendRate
 #if UE_ENABLE_DEBUG_DRAWING
-		, &DebugBlendWeightString, &bDebugPhysicsBlendWeights
+	// Debug drawing for blend weights
+	if (bDebugPhysicsBlendWeights)
+	{
+		for (const FHitReactPhysics& Physics : PhysicsBlends)
+		{
+			if (Physics.IsActive())
+			{
+				DebugBlendWeightString += FString::Printf(TEXT("%s: [ %s ] %.2f\n"), *Physics.SimulatedBoneName.ToString(),
+					*Physics.PhysicsState.GetBlendStateString(), Physics.PhysicsState.GetBlendStateAlpha());
+			}
+			else
+			{
+				DebugBlendWeightString += FString::Printf(TEXT("%s: [ %s ]\n"), *Physics.SimulatedBoneName.ToString(),
+					*Physics.PhysicsState.GetBlendStateString());
+			}
+		}
+	}
 #endif
-		](FHitReactPhysics& Physics)
+
+	// Bones that are no longer accumulated have finished reacting
+	if (Backend == EHitReactBackend::AnimNode)
 	{
-		// Cache the previous blend weight
-		const float LastBlendWeight = Physics.RequestedBlendWeight;
+		AnimBoneWeights.Reset();
+	}
+	ReactingBoneWeights.Reset();
+	StrongestReactingBone = NAME_None;
+	float StrongestBoneWeight = 0.f;
 
-		// Update the physics blend
-		Physics.Tick(DeltaTime);
+	// Apply the final blend weights, interpolated between the last two steps so they're smooth at any frame rate
+	for (const auto& Pair : SimulatedBoneWeights)
+	{
+		const float* PreviousWeight = PreviousBoneWeights.Find(Pair.Key);
+		const float BoneWeight = PreviousWeight ? FMath::Lerp(*PreviousWeight, Pair.Value, InterpAlpha) : Pair.Value;
 
-		bool bShouldRemove = Physics.HasCompleted();
-		
-		// Accumulate the blend weights for each bone
-		UHitReactStatics::ForEach(Mesh, Physics.SimulatedBoneName, true,
-	[this, DeltaTime, &Physics, &LastBlendWeight, &GlobalAlpha, &AccumulatedBoneWeights, &bShouldRemove, &BoneBlendRate]
-			(const FBodyInstance* BI)
+		if (Backend == EHitReactBackend::AnimNode)
 		{
-			const FName BoneName = UHitReactStatics::GetBoneName(Mesh, BI);
-			if (Physics.DisabledBones.Contains(BoneName))
+			AnimBoneWeights.Add(Pair.Key, BoneWeight);
+		}
+		else
+		{
+			if (UHitReactStatics::SetBlendWeight(Mesh, Pair.Key, BoneWeight))
 			{
-				// Don't simulate this bone
-				return true;  // Continue to the next bone
+				TouchedBones.Add(Pair.Key);
 			}
+		}
 
-			// Get the current blend weight for this bone
-			if (!AccumulatedBoneWeights.Contains(BoneName))
+		// Cache for the query functions
+		if (BoneWeight > 0.f)
+		{
+			ReactingBoneWeights.Add(Pair.Key, BoneWeight);
+			if (BoneWeight > StrongestBoneWeight)
 			{
-				AccumulatedBoneWeights.Add(BoneName, UHitReactStatics::GetBoneBlendWeight(Mesh, BoneName));
-			}
-	
-			// Apply decay so old reactions smoothly reduce their influence
-			float& AccumulatedWeight = AccumulatedBoneWeights.FindChecked(BoneName);
-		
-			// Scale blend weight per-bone
-			const float BoneBlendWeightScalar = Physics.BoneWeightScalars.Contains(BoneName) ? Physics.BoneWeightScalars[BoneName] : 1.f;
-			const float AppliedBlendWeight = Physics.RequestedBlendWeight * BoneBlendWeightScalar;
-		
-			// Blend in new weight smoothly
-			AccumulatedWeight = FMath::Lerp(AccumulatedWeight, AppliedBlendWeight, 1.f - FMath::Exp(-BoneBlendRate * DeltaTime));
-
-			// Clamp to 0-1
-			AccumulatedWeight = FMath::Clamp(AccumulatedWeight, 0.f, 1.f);
-
-			// Delay removal until weight is nearly zero**
-			if (!FMath::IsNearlyZero(AccumulatedWeight, 0.01f))
-			{
-				bShouldRemove = false;
-			}
-
-			return true;  // Continue to the next bone
-		});
-
-#if UE_ENABLE_DEBUG_DRAWING
-		// Debug drawing for blend weights
-		if (bDebugPhysicsBlendWeights)
-		{
-			if (Physics.IsActive())
-			{
-				DebugBlendWeightString += FString::Printf(TEXT("%s: [ %s ] %.2f\n"), *Physics.SimulatedBoneName.ToString(),
-					*Physics.PhysicsState.GetBlendStateString(), Physics.PhysicsState.GetBlendStateAlpha());
-			}
-			else
-			{
-				DebugBlendWeightString += FString::Printf(TEXT("%s: [ %s ]\n"), *Physics.SimulatedBoneName.ToString(),
-					*Physics.PhysicsState.GetBlendStateString());
+				StrongestBoneWeight = BoneWeight;
+				StrongestReactingBone = Pair.Key;
 			}
 		}
-#endif
-		
-		return bShouldRemove;
-	});
-
-	// Apply the final accumulated blend weights
-	for (const auto& Pair : AccumulatedBoneWeights)
-	{
-		UHitReactStatics::SetBlendWeight(Mesh, Pair.Key, Pair.Value);
 
 #if UE_ENABLE_DEBUG_DRAWING
 		// Debug drawing for per-bone weights
 		if (bDebugPhysicsBoneWeights)
 		{
 			const FName& BoneName = Pair.Key;
-			DebugBoneWeightString += FString::Printf(TEXT("%s: %.2f\n"), *BoneName.ToString(), Pair.Value);
+			DebugBoneWeightString += FString::Printf(TEXT("%s: %.2f\n"), *BoneName.ToString(), BoneWeight);
 		}
 #endif
 	}
@@ -665,30 +1179,42 @@ void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorC
 	// Restore our Mesh if all physics blends have been completed
 	if (PhysicsBlends.Num() == 0)
 	{
-		// Restore the collision enabled state
-		if (bCollisionEnabledChanged)
+		// Restore the collision enabled state, unless the residency policy keeps it
+		if (bCollisionEnabledChanged && PhysicsResidency.Policy == EHitReactPhysicsResidency::Lazy)
 		{
-			Mesh->SetCollisionEnabled(DefaultCollisionEnabled);
-			bCollisionEnabledChanged = false;
+			if (PhysicsResidency.IdleTimeout > 0.f)
+			{
+				GetWorld()->GetTimerManager().SetTimer(PhysicsIdleTimerHandle, this, &ThisClass::OnPhysicsIdleTimeout,
+					PhysicsResidency.IdleTimeout, false);
+			}
+			else
+			{
+				ReleasePhysicsResidency();
+			}
 		}
 
-		// Remove the constraint profile
-		if (bConstraintProfileChanged)
-		{
-			Mesh->SetConstraintProfileForAll(FName(NAME_None));
-			bConstraintProfileChanged = false;
-		}
+		// Remove the constraint and physical anim profiles
+		RestoreProfiles();
 
-		// Remove the physical anim profile
-		if (bPhysicalAnimationProfileChanged)
-		{
-			PhysicalAnimation->ApplyPhysicalAnimationProfileBelow(FName(NAME_None), FName(NAME_None), false);
-			bPhysicalAnimationProfileChanged = false;
-		}
+		// Nothing left for the anim node to blend
+		AnimBoneWeights.Reset();
+		ReactingBoneWeights.Reset();
+		StrongestReactingBone = NAME_None;
+
+		// Blends are removed with a little weight remaining, don't leave those bodies simulating
+		RestoreTouchedBodies();
+
+		// Start the next hit react from a clean step
+		SimulationTimeAccumulator = 0.f;
+		PreviousBoneWeights.Reset();
+		SimulatedBoneWeights.Reset();
 	}
 
 	// Finalize the physics simulation for the mesh
-	UHitReactStatics::FinalizeMeshPhysics(Mesh);
+	if (Backend == EHitReactBackend::Physics)
+	{
+		UHitReactStatics::FinalizeMeshPhysics(Mesh);
+	}
 
 	if (PendingImpulse.IsValid())
 	{
@@ -728,6 +1254,173 @@ void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorC
 		// Disable tick
 		SleepHitReact();
 	}
+	// Or until the next blend state begins, if the bone weights are holding until then
+	else if (const float HoldSleepTime = GetBlendHoldSleepTime(); HoldSleepTime > DeltaTime * 2.f)
+	{
+		SleepHitReactFor(HoldSleepTime);
+	}
+}
+
+void UHitReact::StepPhysicsBlends(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::StepPhysicsBlends);
+
+	// Keep the last step for interpolation
+	PreviousBoneWeights = SimulatedBoneWeights;
+
+	// Accumulate final blend weights per bone
+	TMap<FName, float> AccumulatedBoneWeights;
+
+	// Scale the blend rate by the global alpha
+	const float GlobalAlpha = GlobalToggle.State.GetBlendStateAlpha();
+
+	// Average the blend rates of each profile
+	float BoneBlendRate = 0.f;
+	for (const FHitReactPhysics& Physics : PhysicsBlends)
+	{
+		BoneBlendRate += Physics.CompiledProfile ? Physics.CompiledProfile->BoneBlendRate : 0.f;
+	}
+	BoneBlendRate /= FMath::Max(1, PhysicsBlends.Num());
+
+	// Tick each physics blend and accumulate the blend weights
+	PhysicsBlendTime += DeltaTime;
+	PhysicsBlends.RemoveAll([this, DeltaTime, &GlobalAlpha, &AccumulatedBoneWeights, &BoneBlendRate](FHitReactPhysics& Physics)
+	{
+		// Cache the previous blend weight
+		const float LastBlendWeight = Physics.RequestedBlendWeight;
+
+		// Update the physics blend
+		Physics.Evaluate(PhysicsBlendTime);
+
+		bool bShouldRemove = Physics.HasCompleted();
+		
+		// Accumulate the blend weights for each bone
+		ForEachBone(Physics.SimulatedBoneName, true,
+	[this, DeltaTime, &Physics, &LastBlendWeight, &GlobalAlpha, &AccumulatedBoneWeights, &bShouldRemove, &BoneBlendRate]
+			(const FName& BoneName)
+		{
+			if (Physics.DisabledBones.Contains(BoneName))
+			{
+				// Don't simulate this bone
+				return true;  // Continue to the next bone
+			}
+
+			// Get the current blend weight for this bone, from the last step if we have one
+			if (!AccumulatedBoneWeights.Contains(BoneName))
+			{
+				const float* SimulatedWeight = SimulatedBoneWeights.Find(BoneName);
+				AccumulatedBoneWeights.Add(BoneName, SimulatedWeight ? *SimulatedWeight : GetCurrentBoneWeight(BoneName));
+			}
+	
+			// Apply decay so old reactions smoothly reduce their influence
+			float& AccumulatedWeight = AccumulatedBoneWeights.FindChecked(BoneName);
+		
+			// Scale blend weight per-bone
+			const float BoneBlendWeightScalar = Physics.BoneWeightScalars.Contains(BoneName) ? Physics.BoneWeightScalars[BoneName] : 1.f;
+			const float AppliedBlendWeight = Physics.RequestedBlendWeight * BoneBlendWeightScalar;
+		
+			// Blend in new weight smoothly
+			AccumulatedWeight = FMath::Lerp(AccumulatedWeight, AppliedBlendWeight, 1.f - FMath::Exp(-BoneBlendRate * DeltaTime));
+
+			// Clamp to 0-1
+			AccumulatedWeight = FMath::Clamp(AccumulatedWeight, 0.f, 1.f);
+
+			// Delay removal until weight is nearly zero**
+			if (!FMath::IsNearlyZero(AccumulatedWeight, 0.01f))
+			{
+				bShouldRemove = false;
+			}
+
+			return true;  // Continue to the next bone
+		});
+
+		return bShouldRemove;
+	});
+
+	SimulatedBoneWeights = MoveTemp(AccumulatedBoneWeights);
+}
+
+bool UHitReact::ShouldSkipBoneWeights() const
+{
+	// Dedicated servers don't render, and we always want to see our own hit reacts
+	if (!Culling.bSkipWeightsWhenNotRendered || !Mesh || GetNetMode() == NM_DedicatedServer || IsLocallyControlledPlayer())
+	{
+		return false;
+	}
+	return !Mesh->WasRecentlyRendered(Culling.RecentlyRenderedTolerance);
+}
+
+void UHitReact::AdvancePhysicsBlends(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::AdvancePhysicsBlends);
+
+	PhysicsBlendTime += DeltaTime;
+	PhysicsBlends.RemoveAll([this](FHitReactPhysics& Physics)
+	{
+		Physics.Evaluate(PhysicsBlendTime);
+		return Physics.HasCompleted();
+	});
+}
+
+void UHitReact::CatchUpBoneWeights()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::CatchUpBoneWeights);
+
+	bSkippedBoneWeights = false;
+
+	// Bones we were driving go to zero unless a blend still covers them
+	TMap<FName, float> BoneWeights;
+	for (const TPair<FName, float>& Pair : SimulatedBoneWeights)
+	{
+		BoneWeights.Add(Pair.Key, 0.f);
+	}
+
+	// Take the strongest weight requested for each bone, there is nothing to blend from
+	for (const FHitReactPhysics& Physics : PhysicsBlends)
+	{
+		ForEachBone(Physics.SimulatedBoneName, true, [&Physics, &BoneWeights](const FName& BoneName)
+		{
+			if (!Physics.DisabledBones.Contains(BoneName))
+			{
+				const float* BoneWeightScalar = Physics.BoneWeightScalars.Find(BoneName);
+				const float BoneWeight = FMath::Clamp(Physics.RequestedBlendWeight * (BoneWeightScalar ? *BoneWeightScalar : 1.f), 0.f, 1.f);
+				float& Weight = BoneWeights.FindOrAdd(BoneName);
+				Weight = FMath::Max(Weight, BoneWeight);
+			}
+			return true;  // Continue to the next bone
+		});
+	}
+
+	// Apply them now, bones that no blend covers are never stepped again so this is the only chance to zero them
+	ReactingBoneWeights.Reset();
+	StrongestReactingBone = NAME_None;
+	float StrongestBoneWeight = 0.f;
+	for (auto It = BoneWeights.CreateIterator(); It; ++It)
+	{
+		if (Backend == EHitReactBackend::Physics && UHitReactStatics::SetBlendWeight(Mesh, It.Key(), It.Value()))
+		{
+			TouchedBones.Add(It.Key());
+		}
+
+		if (It.Value() <= 0.f)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Cache for the query functions
+		ReactingBoneWeights.Add(It.Key(), It.Value());
+		if (It.Value() > StrongestBoneWeight)
+		{
+			StrongestBoneWeight = It.Value();
+			StrongestReactingBone = It.Key();
+		}
+	}
+
+	// Continue stepping from here without interpolating from stale weights
+	SimulatedBoneWeights = MoveTemp(BoneWeights);
+	PreviousBoneWeights = SimulatedBoneWeights;
+	SimulationTimeAccumulator = 0.f;
 }
 
 void UHitReact::TickGlobalToggle(float DeltaTime)
@@ -748,35 +1441,11 @@ void UHitReact::TickGlobalToggle(float DeltaTime)
 #endif
 
 	// Check if we need to toggle this ability on or off
-#if WITH_GAMEPLAY_ABILITIES
-	if (GlobalToggle.bToggleStateUsingTags && !bDisabledGlobal)
+	// Tag changes are event driven, we only look for the AbilitySystemComponent until we've registered with it
+	if (GlobalToggle.bToggleStateUsingTags && !bDisabledGlobal && !bToggleTagEventsRegistered)
 	{
-		AbilitySystemComponent = AbilitySystemComponent.IsValid() ?
-			AbilitySystemComponent.Get() : UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner());
-		if (AbilitySystemComponent.IsValid())
-		{
-			// Possibly disable the system
-			if (IsHitReactSystemEnabled())
-			{
-				// Check if we need to disable the system
-				if (AbilitySystemComponent->HasAnyMatchingGameplayTags(GlobalToggle.DisableTags))
-				{
-					ToggleHitReactSystem(false, true);
-				}
-			}
-
-			// Possibly enable the system
-			if (IsHitReactSystemDisabled())
-			{
-				// Check if we need to enable the system
-				if (AbilitySystemComponent->HasAnyMatchingGameplayTags(GlobalToggle.EnableTags))
-				{
-					ToggleHitReactSystem(true, true);
-				}
-			}
-		}
+		RegisterToggleTagEvents();
 	}
-#endif
 
 	// Update the global alpha interpolation
 	const EHitReactToggleState LastToggleState = GetHitReactToggleState();
@@ -797,12 +1466,133 @@ void UHitReact::TickGlobalToggle(float DeltaTime)
 	}
 }
 
-void UHitReact::ApplyImpulse(const FHitReactPendingImpulse& Impulse) const
+bool UHitReact::RegisterToggleTagEvents()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::RegisterToggleTagEvents);
+
+#if WITH_GAMEPLAY_ABILITIES
+	UnregisterToggleTagEvents();
+
+	if (!GlobalToggle.bToggleStateUsingTags)
+	{
+		return false;
+	}
+
+	AbilitySystemComponent = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner());
+	if (!AbilitySystemComponent.IsValid())
+	{
+		return false;
+	}
+
+	// Listen for each tag being added or removed
+	for (const FGameplayTagContainer* Tags : { &GlobalToggle.DisableTags, &GlobalToggle.EnableTags })
+	{
+		for (const FGameplayTag& Tag : *Tags)
+		{
+			FDelegateHandle Handle = AbilitySystemComponent->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::NewOrRemoved)
+				.AddUObject(this, &ThisClass::OnToggleTagChanged);
+			ToggleTagEventHandles.Emplace(Tag, Handle);
+		}
+	}
+	bToggleTagEventsRegistered = true;
+
+	// Catch up on the tags we already have
+	UpdateToggleFromTags();
+	return true;
+#else
+	return false;
+#endif
+}
+
+void UHitReact::UnregisterToggleTagEvents()
+{
+#if WITH_GAMEPLAY_ABILITIES
+	if (UAbilitySystemComponent* ASC = AbilitySystemComponent.Get())
+	{
+		for (const TPair<FGameplayTag, FDelegateHandle>& Event : ToggleTagEventHandles)
+		{
+			ASC->UnregisterGameplayTagEvent(Event.Value, Event.Key, EGameplayTagEventType::NewOrRemoved);
+		}
+	}
+	ToggleTagEventHandles.Reset();
+#endif
+	bToggleTagEventsRegistered = false;
+}
+
+void UHitReact::UpdateToggleFromTags()
+{
+#if WITH_GAMEPLAY_ABILITIES
+#if !UE_BUILD_SHIPPING
+	if (FHitReactCVars::HitReactDisabled == 1)
+	{
+		return;
+	}
+#endif
+
+	if (!AbilitySystemComponent.IsValid())
+	{
+		return;
+	}
+
+	// Possibly disable the system
+	if (IsHitReactSystemEnabled())
+	{
+		// Check if we need to disable the system
+		if (AbilitySystemComponent->HasAnyMatchingGameplayTags(GlobalToggle.DisableTags))
+		{
+			ToggleHitReactSystem(false, true);
+		}
+	}
+
+	// Possibly enable the system
+	if (IsHitReactSystemDisabled())
+	{
+		// Check if we need to enable the system
+		if (AbilitySystemComponent->HasAnyMatchingGameplayTags(GlobalToggle.EnableTags))
+		{
+			ToggleHitReactSystem(true, true);
+		}
+	}
+#endif
+}
+
+void UHitReact::OnToggleTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	// ToggleHitReactSystem wakes us if the state changes
+	UpdateToggleFromTags();
+}
+
+void UHitReact::TickDeferredHitReact()
+{
+	if (!DeferredHitReact.IsValid())
+	{
+		return;
+	}
+
+	// Waited too long, the moment has passed
+	if (GetWorld()->TimeSince(DeferredHitReact.Time) > Culling.MaxDeferTime)
+	{
+		DeferredHitReact = {};
+		return;
+	}
+
+	// Still not visible
+	if (GetCullResponse() == EHitReactCullResponse::Defer)
+	{
+		return;
+	}
+
+	const FHitReactDeferredHitReact Deferred = DeferredHitReact;
+	DeferredHitReact = {};
+	HitReact(Deferred.Params, Deferred.Impulse, Deferred.World, Deferred.ImpulseScalar);
+}
+
+void UHitReact::ApplyImpulse(const FHitReactPendingImpulse& Impulse)
 {
 	ApplyImpulse(Impulse.Impulse, Impulse.World, Impulse.ImpulseScalar, Impulse.Profile, Impulse.ImpulseBoneName);
 }
 
-void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitReactImpulse_WorldParams& World, float ImpulseScalar, const UHitReactProfile* Profile, FName ImpulseBoneName) const
+void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitReactImpulse_WorldParams& World, float ImpulseScalar, const UHitReactProfile* Profile, FName ImpulseBoneName)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ApplyImpulse);
 	
@@ -818,19 +1608,11 @@ void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitRe
 
 	// Throttle impulse based on number of applications
 	float ThrottleScalar = 1.f;
-	if (Profile->SubsequentImpulseScalars.Num() > 0)
+	const FHitReactCompiledProfile& Compiled = Profile->GetCompiled();
+	if (Compiled.SubsequentImpulseTimes.Num() > 0)
 	{
 		// Find the scalar for the number of applications based on the last hit react time
-		const float TimeSinceLastHitReact = GetWorld()->TimeSince(LastHitReactTime);
-		for (int32 i = 0; i < Profile->SubsequentImpulseScalars.Num(); i++)
-		{
-			const FHitReactSubsequentImpulse& SubsequentImpulse = Profile->SubsequentImpulseScalars[i];
-			if (TimeSinceLastHitReact < SubsequentImpulse.ElapsedTime)
-			{
-				ThrottleScalar = SubsequentImpulse.ImpulseScalar;
-				break;
-			}
-		}
+		ThrottleScalar = Compiled.GetSubsequentImpulseScalar(GetWorld()->TimeSince(LastHitReactTime));
 	}
 
 	// Linear impulse
@@ -843,13 +1625,24 @@ void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitRe
 		if (!Linear.IsNearlyZero())
 		{
 			// Apply impulse to impulse bone if set, otherwise apply to simulated bone
-			Mesh->AddImpulse(Linear, ImpulseBoneName, LinearParams.IsVelocityChange());
-			
-#if UE_ENABLE_DEBUG_DRAWING
-			if (FHitReactCVars::DrawHitReact > 0)
+			if (Backend == EHitReactBackend::AnimNode)
 			{
-				const FVector Start = Mesh->GetSocketLocation(ImpulseBoneName);
-				const FVector End = Start + Linear.GetSafeNormal() * 100.f;
+				QueueAnimImpulse(ImpulseBoneName, Linear, false, LinearParams.IsVelocityChange());
+			}
+			else if (AsyncPhysics.IsValid())
+			{
+				AsyncPhysics.AddImpulse(Mesh->GetBodyInstance(ImpulseBoneName), Linear, LinearParams.IsVelocityChange());
+			}
+			else
+			{
+				Mesh->AddImpulse(Linear, ImpulseBoneName, LinearParams.IsVelocityChange());
+			}
+			
+#if UE_ENABLE_DEBUG_DRAWING
+			if (FHitReactCVars::DrawHitReact > 0)
+			{
+				const FVector Start = Mesh->GetSocketLocation(ImpulseBoneName);
+				const FVector End = Start + Linear.GetSafeNormal() * 100.f;
 				DrawDebugDirectionalArrow(Mesh->GetWorld(), Start, End, 10.f, FColor::Green, false, 1.5f);
 			}
 #endif
@@ -866,14 +1659,29 @@ void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitRe
 		if (!Angular.IsNearlyZero())
 		{
 			// Apply impulse to impulse bone if set, otherwise apply to simulated bone
-			switch (AngularParams.AngularUnits)
+			if (Backend == EHitReactBackend::AnimNode || AsyncPhysics.IsValid())
+			{
+				const FVector AngularRadians = AngularParams.AngularUnits == EHitReactUnits::Degrees ? FMath::DegreesToRadians(Angular) : Angular;
+				if (Backend == EHitReactBackend::AnimNode)
+				{
+					QueueAnimImpulse(ImpulseBoneName, AngularRadians, true, AngularParams.IsVelocityChange());
+				}
+				else
+				{
+					AsyncPhysics.AddAngularImpulseInRadians(Mesh->GetBodyInstance(ImpulseBoneName), AngularRadians, AngularParams.IsVelocityChange());
+				}
+			}
+			else
 			{
-			case EHitReactUnits::Degrees:
-				Mesh->AddAngularImpulseInDegrees(Angular, ImpulseBoneName, AngularParams.IsVelocityChange());
-				break;
-			case EHitReactUnits::Radians:
-				Mesh->AddAngularImpulseInRadians(Angular, ImpulseBoneName, AngularParams.IsVelocityChange());
-				break;
+				switch (AngularParams.AngularUnits)
+				{
+				case EHitReactUnits::Degrees:
+					Mesh->AddAngularImpulseInDegrees(Angular, ImpulseBoneName, AngularParams.IsVelocityChange());
+					break;
+				case EHitReactUnits::Radians:
+					Mesh->AddAngularImpulseInRadians(Angular, ImpulseBoneName, AngularParams.IsVelocityChange());
+					break;
+				}
 			}
 
 #if UE_ENABLE_DEBUG_DRAWING
@@ -899,8 +1707,31 @@ void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitRe
 			const ERadialImpulseFalloff Falloff = RadialParams.Falloff == EHitReactFalloff::Linear ? RIF_Linear : RIF_Constant;
 				
 			// Convert falloff
-			Mesh->AddRadialImpulse(World.RadialLocation, RadialParams.Radius, RadialParams.Impulse,
-			                       Falloff, RadialParams.IsVelocityChange());
+			if (Backend == EHitReactBackend::AnimNode)
+			{
+				// Only reacting bones are blended by the anim node
+				for (const auto& Pair : AnimBoneWeights)
+				{
+					const FVector Delta = Mesh->GetBoneLocation(Pair.Key) - World.RadialLocation;
+					const float Distance = Delta.Size();
+					if (Distance <= RadialParams.Radius)
+					{
+						const float FalloffScalar = Falloff == RIF_Linear && RadialParams.Radius > 0.f ? 1.f - Distance / RadialParams.Radius : 1.f;
+						QueueAnimImpulse(Pair.Key, Delta.GetSafeNormal() * RadialParams.Impulse * FalloffScalar, false,
+							RadialParams.IsVelocityChange());
+					}
+				}
+			}
+			else if (AsyncPhysics.IsValid())
+			{
+				AsyncPhysics.AddRadialImpulse(Mesh, World.RadialLocation, RadialParams.Radius, RadialParams.Impulse,
+					Falloff, RadialParams.IsVelocityChange());
+			}
+			else
+			{
+				Mesh->AddRadialImpulse(World.RadialLocation, RadialParams.Radius, RadialParams.Impulse,
+				                       Falloff, RadialParams.IsVelocityChange());
+			}
 
 #if UE_ENABLE_DEBUG_DRAWING
 			if (FHitReactCVars::DrawHitReact > 0)
@@ -914,6 +1745,59 @@ void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitRe
 	}
 }
 
+void UHitReact::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Replicate the event buffer
+	if (bReplicateHitReactEvents && GetOwner() && GetOwner()->HasAuthority())
+	{
+		SetIsReplicated(true);
+	}
+}
+
+void UHitReact::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Unregister from the physics solver before it is torn down
+	AsyncPhysics.Release();
+
+	// Let the shared profiles unload once nothing else uses them
+	ReleaseSharedAssets();
+
+	// Stop listening for the toggle tags
+	UnregisterToggleTagEvents();
+
+	// The mesh is likely going away too, so stop tracking residency without reverting the collision
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PhysicsIdleTimerHandle);
+		World->GetTimerManager().ClearTimer(WakeTimerHandle);
+		if (UHitReactResidencySubsystem* Residency = World->GetSubsystem<UHitReactResidencySubsystem>())
+		{
+			Residency->RemoveResident(this);
+		}
+		if (UHitReactScheduler* Scheduler = World->GetSubsystem<UHitReactScheduler>())
+		{
+			Scheduler->Unregister(this);
+		}
+	}
+
+	// Don't keep tracking a mesh we no longer drive
+	if (Mesh)
+	{
+		UHitReactStatics::ResetWeightedBodies(Mesh);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UHitReact::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ThisClass, ReplicatedEvents);
+}
+
 void UHitReact::Activate(bool bReset)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::Activate);
@@ -924,104 +1808,840 @@ void UHitReact::Activate(bool bReset)
 		return;
 	}
 
-	// Dedicated servers don't need cosmetic hit reacts - unless perhaps you're doing some kind of replay system
-	if (GetNetMode() == NM_DedicatedServer && !bApplyHitReactOnDedicatedServer)
+	// Dedicated servers don't need cosmetic hit reacts - unless perhaps you're doing some kind of replay system
+	if (GetNetMode() == NM_DedicatedServer && !bApplyHitReactOnDedicatedServer)
+	{
+		return;
+	}
+
+	const bool bWasActive = IsActive();
+
+	if (!IsActive())
+	{
+		OwnerPawn = IsValid(GetOwner()) ? Cast<APawn>(GetOwner()) : nullptr;
+		
+		// Call the pre-activate event, which can be overridden in blueprint or C++ to cast and cache the owner
+		PreActivate(bReset);
+	}
+	
+	// Cache anything we need from the owner
+	if (Mesh != GetMeshFromOwner() || PhysicalAnimation != GetPhysicalAnimationComponentFromOwner() || bReset)
+	{
+		// Unbind from the old mesh
+		if (PhysicalAnimation && Mesh && PhysicalAnimation->GetSkeletalMesh() == Mesh)
+		{
+			PhysicalAnimation->SetSkeletalMeshComponent(nullptr);
+		}
+
+		// Cache the new mesh and physical animation
+		Mesh = GetMeshFromOwner();
+		PhysicalAnimation = GetPhysicalAnimationComponentFromOwner();
+
+		// Bind to the new mesh
+		if (PhysicalAnimation)
+		{
+			PhysicalAnimation->SetSkeletalMeshComponent(Mesh);
+		}
+	}
+
+	if (IsValid(Mesh))
+	{
+		Super::Activate(bReset);
+		if (IsActive() && (!bWasActive || bReset))
+		{
+			// Load the profiles
+			bProfilesLoaded = false;
+			ActiveProfiles.Empty();
+			CancelAsyncLoading();
+			ReleaseSharedAssets();
+
+			// Share the loaded assets with every other component in the game instance
+			UWorld* World = GetWorld();
+			UHitReactLoadingSubsystem* Loading = World ? UGameInstance::GetSubsystem<UHitReactLoadingSubsystem>(World->GetGameInstance()) : nullptr;
+			if (Loading)
+			{
+				ActiveBoneData.Empty();
+				for (const TSoftObjectPtr<UHitReactProfile>& ProfilePtr : AvailableProfiles)
+				{
+					if (!ProfilePtr.IsNull()) { SharedAssetPaths.AddUnique(ProfilePtr.ToSoftObjectPath()); }
+				}
+				for (const TSoftObjectPtr<UHitReactBoneData>& BoneDataPtr : AvailableBoneData)
+				{
+					if (!BoneDataPtr.IsNull()) { SharedAssetPaths.AddUnique(BoneDataPtr.ToSoftObjectPath()); }
+				}
+
+				// Initialize immediately if another component already loaded everything
+				const uint32 RequestId = SharedAssetRequestId;
+				const FSimpleDelegate OnLoaded = FSimpleDelegate::CreateWeakLambda(this, [this, RequestId]()
+				{
+					if (RequestId == SharedAssetRequestId)
+					{
+						OnSharedAssetsLoaded();
+					}
+				});
+				if (Loading->AcquireAssets(SharedAssetPaths, OnLoaded))
+				{
+					OnSharedAssetsLoaded();
+				}
+				return;
+			}
+
+			for (TSoftObjectPtr<UHitReactProfile>& ProfilePtr : AvailableProfiles)
+			{
+				if (ProfilePtr.IsNull()) { continue; }
+				AsyncLoad(ProfilePtr, [this, InnerSoftProfile = MoveTemp(ProfilePtr)]() 
+				{
+					ActiveProfiles.Add(InnerSoftProfile.Get());
+				});
+			}
+			for (TSoftObjectPtr<UHitReactBoneData>& BoneDataPtr : AvailableBoneData)
+			{
+				if (BoneDataPtr.IsNull()) { continue; }
+				AsyncLoad(BoneDataPtr, [this, InnerSoftBoneData = MoveTemp(BoneDataPtr)]() 
+				{
+					ActiveBoneData.Add(InnerSoftBoneData.Get());
+				});
+			}
+			StartAsyncLoading();
+		}
+	}
+	else
+	{
+		const FString ErrorString = FString::Printf(TEXT(
+			"HitReactComponent: Mesh attempted initialization before valid for %s. System will not run."),
+			*GetOwner()->GetName());
+#if !UE_BUILD_SHIPPING
+		FMessageLog("PIE").Error(FText::FromString(ErrorString));
+#else
+		UE_LOG(LogHitReact, Error, TEXT("%s"), *ErrorString);
+#endif
+	}
+}
+
+void UHitReact::Deactivate()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::Deactivate);
+	
+	Super::Deactivate();
+
+	bHasInitialized = false;
+	bProfilesLoaded = false;
+	if (!IsActive())
+	{
+		ResetHitReactSystem();
+		ReleasePhysicsResidency();
+		AsyncPhysics.Release();
+		ReleaseSharedAssets();
+		UnregisterToggleTagEvents();
+	}
+}
+
+void UHitReact::OnSharedAssetsLoaded()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::OnSharedAssetsLoaded);
+
+	ActiveProfiles.Reset();
+	for (const TSoftObjectPtr<UHitReactProfile>& ProfilePtr : AvailableProfiles)
+	{
+		if (const UHitReactProfile* Profile = ProfilePtr.Get())
+		{
+			ActiveProfiles.AddUnique(Profile);
+		}
+	}
+
+	ActiveBoneData.Reset();
+	for (const TSoftObjectPtr<UHitReactBoneData>& BoneDataPtr : AvailableBoneData)
+	{
+		if (const UHitReactBoneData* BoneData = BoneDataPtr.Get())
+		{
+			ActiveBoneData.AddUnique(BoneData);
+		}
+	}
+
+	OnFinishedLoading();
+}
+
+void UHitReact::ReleaseSharedAssets()
+{
+	// Ignore any load still in flight for our previous request
+	SharedAssetRequestId++;
+
+	if (SharedAssetPaths.Num() > 0)
+	{
+		UWorld* World = GetWorld();
+		if (UHitReactLoadingSubsystem* Loading = World ? UGameInstance::GetSubsystem<UHitReactLoadingSubsystem>(World->GetGameInstance()) : nullptr)
+		{
+			Loading->ReleaseAssets(SharedAssetPaths);
+		}
+		SharedAssetPaths.Reset();
+	}
+}
+
+void UHitReact::OnFinishedLoading()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::OnFinishedLoading);
+	
+	bProfilesLoaded = true;
+	bHasInitialized = true;
+
+	// Resolve profiles by tag for HitReactByTag
+	BuildProfileTagTable();
+
+	// Initialize the tick function
+	PrimaryComponentTick.bAllowTickOnDedicatedServer = bApplyHitReactOnDedicatedServer;
+	PrimaryComponentTick.GetPrerequisites().Reset();
+	BindToMesh();
+	PrimaryComponentTick.SetTickFunctionEnable(true);
+
+	// Send impulses to the physics thread
+	if (bUseAsyncPhysics)
+	{
+		AsyncPhysics.Initialize(GetWorld());
+	}
+
+	// Switch collision now rather than hitching on the first hit react
+	if (Backend == EHitReactBackend::Physics && PhysicsResidency.Policy == EHitReactPhysicsResidency::Prewarm)
+	{
+		MakePhysicsResident();
+	}
+
+	// Initialize the global alpha interpolation
+	GlobalToggle.State.BlendParams = GlobalToggle.Params;  // Use the default parameters
+	GlobalToggle.State.Initialize(true);
+
+	// React to the toggle tags being added or removed
+	if (GlobalToggle.bToggleStateUsingTags)
+	{
+		RegisterToggleTagEvents();
+	}
+
+	// Broadcast the initialization event
+	for (const TSharedRef<FOnHitReactInitialized>& Delegate : RegisteredInitDelegates)
+	{
+		Delegate->Execute();
+	}
+}
+
+void UHitReact::BuildProfileTagTable()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::BuildProfileTagTable);
+
+	ProfilesByTag.Reset();
+	for (const TObjectPtr<const UHitReactProfile>& Profile : ActiveProfiles)
+	{
+		if (!Profile || !Profile->ProfileTag.IsValid())
+		{
+			continue;
+		}
+
+#if !UE_BUILD_SHIPPING
+		if (const TObjectPtr<const UHitReactProfile>* Existing = ProfilesByTag.Find(Profile->ProfileTag))
+		{
+			UE_LOG(LogHitReact, Warning, TEXT("%s: profiles { %s } and { %s } share the tag { %s }, using the first"),
+				*GetOwner()->GetName(), *(*Existing)->GetName(), *Profile->GetName(), *Profile->ProfileTag.ToString());
+			continue;
+		}
+#endif
+		ProfilesByTag.FindOrAdd(Profile->ProfileTag, Profile);
+	}
+}
+
+bool UHitReact::OnHitReactInitialized(FOnHitReactInitialized Delegate)
+{
+	if (ensure(Delegate.IsBound()))
+	{
+		if (bHasInitialized)
+		{
+			Delegate.Execute();
+		}
+		else
+		{
+			const TSharedRef<FOnHitReactInitialized> SharedDelegate = MakeShared<FOnHitReactInitialized>(MoveTemp(Delegate));
+			RegisteredInitDelegates.Add(SharedDelegate);
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+void UHitReact::ToggleHitReactSystem(bool bEnabled, bool bInterpolateState, bool bUseDefaultBlendParams,
+	FHitReactPhysicsStateParamsSimple BlendParams)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ToggleHitReactSystem);
+
+	// Dedicated servers don't need cosmetic hit reacts - unless perhaps you're doing some kind of replay system
+	if (GetNetMode() == NM_DedicatedServer && !bApplyHitReactOnDedicatedServer)
+	{
+		return;
+	}
+
+	// Set the global alpha interpolation parameters if we're interpolating
+	if (bInterpolateState)
+	{
+		const FHitReactPhysicsStateParamsSimple& Params = bUseDefaultBlendParams ? GlobalToggle.Params : BlendParams;
+		GlobalToggle.State.BlendParams = Params;
+	}
+	
+	// Only if the state changed
+	if (GlobalToggle.State.bToggleEnabled != bEnabled)
+	{
+		GlobalToggle.State.bToggleEnabled = bEnabled;
+		WakeHitReact();
+		OnHitReactToggleStateChanged.Broadcast(GetHitReactToggleState());
+	}
+}
+
+EHitReactToggleState UHitReact::GetHitReactToggleState() const
+{
+	if (GlobalToggle.State.HasCompleted())
+	{
+		return GlobalToggle.State.bToggleEnabled ? EHitReactToggleState::Enabled : EHitReactToggleState::Disabled;
+	}
+		
+	return GlobalToggle.State.bToggleEnabled ? EHitReactToggleState::Enabling : EHitReactToggleState::Disabling;
+}
+
+bool UHitReact::ShouldSleep() const
+{
+	if (!bHasInitialized || !bProfilesLoaded || ActiveProfiles.Num() == 0)
+	{
+		return true;
+	}
+	if (IsHitReactSystemToggleInProgress())
+	{
+		return false;
+	}
+	if (DeferredHitReact.IsValid())
+	{
+		return false;
+	}
+	if (SpringBlends.Num() > 0)
+	{
+		return false;
+	}
+	if (PhysicsBlends.Num() == 0)
+	{
+		return true;
+	}
+	return false;
+}
+
+bool UHitReact::IsSleeping() const
+{
+	return bHasInitialized && !PrimaryComponentTick.IsTickFunctionEnabled();
+}
+
+void UHitReact::WakeHitReact()
+{
+	if (IsSleeping())
+	{
+		// Blend states are closed-form, so catching up on the time we slept is a single evaluation
+		if (BlendSleepStartTime >= 0.0)
+		{
+			PhysicsBlendTime += GetWorld()->GetTimeSeconds() - BlendSleepStartTime;
+			for (FHitReactPhysics& Physics : PhysicsBlends)
+			{
+				Physics.Evaluate(PhysicsBlendTime);
+			}
+			GetWorld()->GetTimerManager().ClearTimer(WakeTimerHandle);
+			BlendSleepStartTime = -1.0;
+		}
+		PrimaryComponentTick.SetTickFunctionEnable(true);
+	}
+}
+
+void UHitReact::SleepHitReact()
+{
+	PrimaryComponentTick.SetTickFunctionEnable(false);
+
+	// Cancel any timed sleep, we're not expecting to catch up
+	BlendSleepStartTime = -1.0;
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(WakeTimerHandle);
+	}
+
+	// Give up our update slot, there's nothing to catch up on when we wake
+	TimeSlicedDeltaTime = 0.f;
+	FramesSinceUpdate = 0;
+	if (UHitReactScheduler* Scheduler = GetWorld() ? GetWorld()->GetSubsystem<UHitReactScheduler>() : nullptr)
+	{
+		Scheduler->Unregister(this);
+	}
+}
+
+void UHitReact::SleepHitReactFor(float Duration)
+{
+	SleepHitReact();
+
+	BlendSleepStartTime = GetWorld()->GetTimeSeconds();
+	GetWorld()->GetTimerManager().SetTimer(WakeTimerHandle, this, &ThisClass::WakeHitReact, Duration, false);
+}
+
+float UHitReact::GetBlendHoldSleepTime() const
+{
+	// Anything else in flight needs us to keep ticking
+	if (PhysicsBlends.Num() == 0 || SpringBlends.Num() > 0 || DeferredHitReact.IsValid() || PendingImpulse.IsValid() ||
+		IsHitReactSystemToggleInProgress() || bSkippedBoneWeights)
+	{
+		return 0.f;
+	}
+
+	// Wait for the bone weights to settle on their targets
+	for (const TPair<FName, float>& Pair : SimulatedBoneWeights)
+	{
+		const float* PreviousWeight = PreviousBoneWeights.Find(Pair.Key);
+		if (!PreviousWeight || !FMath::IsNearlyEqual(*PreviousWeight, Pair.Value, 1e-3f))
+		{
+			return 0.f;
+		}
+	}
+
+	// Only a hold has a constant weight, and its end time is known in advance
+	float SleepTime = TNumericLimits<float>::Max();
+	for (const FHitReactPhysics& Physics : PhysicsBlends)
+	{
+		const FHitReactPhysicsState& State = Physics.PhysicsState;
+		if (State.GetBlendState() != EHitReactBlendState::BlendHold || State.IsDecaying())
+		{
+			return 0.f;
+		}
+		SleepTime = FMath::Min<float>(SleepTime, State.GetNextStateTime() - State.GetEvaluatedTime());
+	}
+	return SleepTime;
+}
+
+bool UHitReact::ShouldUpdateEveryFrame() const
+{
+	// We always want to see our own hit reacts promptly, and impulses should be applied on the next frame
+	return IsLocallyControlledPlayer() || PendingImpulse.IsValid();
+}
+
+bool UHitReact::NeedsCollisionEnabled() const
+{
+	return Mesh->GetCollisionEnabled() != ECollisionEnabled::QueryAndPhysics && Mesh->GetCollisionEnabled() != ECollisionEnabled::PhysicsOnly;
+}
+
+void UHitReact::MakePhysicsResident()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::MakePhysicsResident);
+
+	// Still in use, don't revert
+	GetWorld()->GetTimerManager().ClearTimer(PhysicsIdleTimerHandle);
+
+	if (!bCollisionEnabledChanged && NeedsCollisionEnabled())
+	{
+		bCollisionEnabledChanged = true;
+		DefaultCollisionEnabled = Mesh->GetCollisionEnabled();
+		switch (DefaultCollisionEnabled)
+		{
+		case ECollisionEnabled::NoCollision:
+		case ECollisionEnabled::ProbeOnly:
+			Mesh->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
+			break;
+		case ECollisionEnabled::QueryOnly:
+		case ECollisionEnabled::QueryAndProbe:
+			Mesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+			break;
+		default: break;
+		}
+	}
+
+	// Track the least recently hit, KeepEnabled is never evicted so doesn't count towards the cap
+	if (bCollisionEnabledChanged && PhysicsResidency.Policy != EHitReactPhysicsResidency::KeepEnabled)
+	{
+		if (UHitReactResidencySubsystem* Residency = GetWorld()->GetSubsystem<UHitReactResidencySubsystem>())
+		{
+			Residency->MarkResident(this);
+		}
+	}
+}
+
+void UHitReact::ReleasePhysicsResidency()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ReleasePhysicsResidency);
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PhysicsIdleTimerHandle);
+		if (UHitReactResidencySubsystem* Residency = World->GetSubsystem<UHitReactResidencySubsystem>())
+		{
+			Residency->RemoveResident(this);
+		}
+	}
+
+	if (bCollisionEnabledChanged)
+	{
+		if (Mesh)
+		{
+			Mesh->SetCollisionEnabled(DefaultCollisionEnabled);
+		}
+		bCollisionEnabledChanged = false;
+	}
+}
+
+bool UHitReact::CanEvictPhysicsResidency() const
+{
+	return PhysicsBlends.Num() == 0 && PhysicsResidency.Policy != EHitReactPhysicsResidency::KeepEnabled;
+}
+
+void UHitReact::OnPhysicsIdleTimeout()
+{
+	if (PhysicsBlends.Num() == 0)
+	{
+		ReleasePhysicsResidency();
+	}
+}
+
+EHitReactCullResponse UHitReact::GetCullResponse() const
+{
+	// Dedicated servers have no view to cull against, and we always want to see our own hit reacts
+	if (!Culling.bEnableCulling || !Mesh || GetNetMode() == NM_DedicatedServer || IsLocallyControlledPlayer())
+	{
+		return EHitReactCullResponse::Apply;
+	}
+
+	// The most restrictive response wins
+	EHitReactCullResponse Response = EHitReactCullResponse::Apply;
+	auto Restrict = [&Response](EHitReactCullResponse InResponse)
+	{
+		Response = static_cast<EHitReactCullResponse>(FMath::Max(static_cast<uint8>(Response), static_cast<uint8>(InResponse)));
+	};
+
+	// Not rendered recently, i.e. off-screen or occluded
+	if (!Mesh->WasRecentlyRendered(Culling.RecentlyRenderedTolerance))
+	{
+		Restrict(Culling.NotRenderedResponse);
+	}
+
+	// Distance to the closest local view
+	const float DistanceSq = GetDistanceSqToLocalView();
+	if (DistanceSq >= 0.f)
+	{
+		if (Culling.CullDistance > 0.f && DistanceSq > FMath::Square(Culling.CullDistance))
+		{
+			Restrict(Culling.CullResponse);
+		}
+		else if (Culling.FarDistance > 0.f && DistanceSq > FMath::Square(Culling.FarDistance))
+		{
+			Restrict(Culling.FarResponse);
+		}
+	}
+
+	return Response;
+}
+
+float UHitReact::GetDistanceSqToLocalView() const
+{
+	float DistanceSq = -1.f;
+	const FVector Location = Mesh->GetComponentLocation();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController && PlayerController->IsLocalController())
+		{
+			// Support split-screen by using the closest view
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+			const float ViewDistanceSq = static_cast<float>(FVector::DistSquared(Location, ViewLocation));
+			DistanceSq = DistanceSq < 0.f ? ViewDistanceSq : FMath::Min(DistanceSq, ViewDistanceSq);
+		}
+	}
+	return DistanceSq;
+}
+
+void UHitReact::ConsumeAnimImpulses(TArray<FHitReactAnimImpulse>& OutImpulses)
+{
+	OutImpulses.Append(AnimImpulses);
+	AnimImpulses.Reset();
+}
+
+int32 UHitReact::ForEachBone(FName BoneName, bool bIncludeSelf, const TFunctionRef<bool(const FName&)>& Func) const
+{
+	if (Backend == EHitReactBackend::AnimNode)
+	{
+		return UHitReactStatics::ForEachBodySetup(Mesh, BoneName, bIncludeSelf, Func);
+	}
+
+	return UHitReactStatics::ForEach(Mesh, BoneName, bIncludeSelf, [this, &Func](const FBodyInstance* BI)
+	{
+		return Func(UHitReactStatics::GetBoneName(Mesh, BI));
+	});
+}
+
+float UHitReact::GetCurrentBoneWeight(const FName& BoneName) const
+{
+	if (Backend == EHitReactBackend::AnimNode)
+	{
+		return AnimBoneWeights.FindRef(BoneName);
+	}
+	return UHitReactStatics::GetBoneBlendWeight(Mesh, BoneName);
+}
+
+void UHitReact::QueueAnimImpulse(const FName& BoneName, const FVector& Impulse, bool bAngular, bool bVelChange)
+{
+	float Mass;
+	float Inertia;
+	if (!GetBoneMassProperties(BoneName, Mass, Inertia))
+	{
+		return;
+	}
+
+	// The anim node only accepts impulses, so convert velocity changes using the body mass
+	FVector FinalImpulse = Impulse;
+	if (bVelChange)
+	{
+		FinalImpulse *= bAngular ? Inertia : Mass;
+	}
+
+	// Don't grow forever if the anim node is missing or not updating
+	if (AnimImpulses.Num() >= 32)
+	{
+		AnimImpulses.RemoveAt(0);
+	}
+	AnimImpulses.Emplace(BoneName, FinalImpulse, bAngular);
+}
+
+bool UHitReact::HitReactSpring(const FHitReactInputParams& Params, const FHitReactImpulseParams& Impulse,
+	const FHitReactImpulse_WorldParams& World, float ImpulseScalar, const UHitReactProfile* Profile)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::HitReactSpring);
+
+	const FHitReactCompiledProfile& Compiled = Profile->GetCompiled();
+
+	// There is no impulse only fallback without physics, so any max blend handling blocks
+	if (Compiled.MaxBlendHandling != EHitReactMaxBlendHandling::Disabled && SpringBlends.Num() >= Compiled.MaxActiveBlends)
+	{
+		return false;
+	}
+
+	// Find the first valid bone, from the physics asset because the bodies may not exist
+	const FName StartingBone = Compiled.RemapSimulatedBone(Params.SimulatedBoneName);
+	FName SimulatedBoneName = NAME_None;
+	UHitReactStatics::ForEachBodySetup(Mesh, StartingBone, Params.bIncludeSelf, [this, &SimulatedBoneName](const FName& BoneName)
+	{
+		if (BlacklistedBones.Contains(BoneName))
+		{
+			return true;  // Continue to the next bone
+		}
+		SimulatedBoneName = BoneName;
+		return false;  // Stop iterating
+	});
+
+	float Mass;
+	float Inertia;
+	if (SimulatedBoneName.IsNone() || !GetBoneMassProperties(SimulatedBoneName, Mass, Inertia))
+	{
+		return false;
+	}
+
+	const FHitReactSpringParams& SpringParams = Compiled.Spring;
+	const float Scalar = ImpulseScalar * SpringParams.ImpulseScalar;
+	const FVector UpVector = Mesh->GetUpVector();
+	FVector AngularVelocity = FVector::ZeroVector;
+
+	// Linear impulses tip the bone as though they were applied at the end of a lever above it
+	auto AddLinearImpulse = [&](const FVector& Linear, bool bVelChange)
+	{
+		const FVector Velocity = bVelChange ? Linear : Linear / Mass;
+		AngularVelocity += FVector::CrossProduct(UpVector, Velocity) / SpringParams.LeverLength;
+	};
+
+	// Linear impulse
+	const FHitReactImpulse_Linear& LinearParams = Impulse.LinearImpulse;
+	if (LinearParams.CanBeApplied())
+	{
+		AddLinearImpulse(LinearParams.GetImpulse(World.LinearDirection) * Scalar, LinearParams.IsVelocityChange());
+	}
+
+	// Angular impulse
+	const FHitReactImpulse_Angular& AngularParams = Impulse.AngularImpulse;
+	if (AngularParams.CanBeApplied())
+	{
+		const FVector Angular = AngularParams.GetImpulse(World.AngularDirection) * Scalar;
+		const FVector AngularRadians = AngularParams.AngularUnits == EHitReactUnits::Degrees ? FMath::DegreesToRadians(Angular) : Angular;
+		AngularVelocity += AngularParams.IsVelocityChange() ? AngularRadians : AngularRadians / Inertia;
+	}
+
+	// Radial impulse
+	const FHitReactImpulse_Radial& RadialParams = Impulse.RadialImpulse;
+	if (RadialParams.CanBeApplied())
+	{
+		const FVector Delta = Mesh->GetBoneLocation(SimulatedBoneName) - World.RadialLocation;
+		const float Distance = Delta.Size();
+		if (Distance <= RadialParams.Radius)
+		{
+			const bool bLinearFalloff = RadialParams.Falloff == EHitReactFalloff::Linear && RadialParams.Radius > 0.f;
+			const float FalloffScalar = bLinearFalloff ? 1.f - Distance / RadialParams.Radius : 1.f;
+			AddLinearImpulse(Delta.GetSafeNormal() * RadialParams.Impulse * FalloffScalar * Scalar, RadialParams.IsVelocityChange());
+		}
+	}
+
+	// Nothing to drive the spring
+	if (AngularVelocity.IsNearlyZero())
+	{
+		return false;
+	}
+
+	// Springs are evaluated in component space
+	AngularVelocity = Mesh->GetComponentTransform().InverseTransformVectorNoScale(AngularVelocity);
+
+	FHitReactSpring& Spring = SpringBlends.Add_GetRef({});
+	Spring.HitReact(Profile, SimulatedBoneName, AngularVelocity);
+
+	// Wake up the hit react system
+	WakeHitReact();
+
+	return true;
+}
+
+bool UHitReact::GetBoneMassProperties(const FName& BoneName, float& OutMass, float& OutInertia) const
+{
+	const UPhysicsAsset* PhysicsAsset = Mesh ? Mesh->GetPhysicsAsset() : nullptr;
+	const int32 BodyIndex = PhysicsAsset ? PhysicsAsset->FindBodyIndex(BoneName) : INDEX_NONE;
+	if (BodyIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const USkeletalBodySetup* BodySetup = PhysicsAsset->SkeletalBodySetups[BodyIndex];
+	OutMass = FMath::Max<float>(BodySetup->CalculateMass(Mesh), UE_KINDA_SMALL_NUMBER);
+
+	// Approximate the inertia as a solid sphere bounding the body
+	const float Radius = BodySetup->AggGeom.CalcAABB(FTransform::Identity).GetExtent().Size();
+	OutInertia = FMath::Max<float>(0.4f * OutMass * FMath::Square(Radius), UE_KINDA_SMALL_NUMBER);
+	return true;
+}
+
+void UHitReact::TickSprings(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::TickSprings);
+
+	SpringBoneRotations.Reset();
+	if (SpringBlends.Num() == 0)
+	{
+		return;
+	}
+
+	// Scale the rotations by the global alpha
+	const float GlobalAlpha = GlobalToggle.State.GetBlendStateAlpha();
+
+	SpringBlends.RemoveAll([this, DeltaTime, GlobalAlpha](FHitReactSpring& Spring)
+	{
+		Spring.Tick(DeltaTime);
+		if (Spring.HasCompleted())
+		{
+			return true;
+		}
+
+		// Combine springs on the same bone
+		FQuat& Rotation = SpringBoneRotations.FindOrAdd(Spring.SimulatedBoneName, FQuat::Identity);
+		Rotation = FQuat::Slerp(FQuat::Identity, Spring.GetRotation(), GlobalAlpha) * Rotation;
+		return false;
+	});
+}
+
+EHitReactTier UHitReact::GetHitReactTier(const UHitReactProfile* Profile) const
+{
+	if (!Profile || !Mesh)
+	{
+		return EHitReactTier::Full;
+	}
+
+	const FHitReactCompiledProfile& Compiled = Profile->GetCompiled();
+	if (Compiled.LODThreshold < 0)
 	{
-		return;
+		return EHitReactTier::Full;
 	}
 
-	const bool bWasActive = IsActive();
-
-	if (!IsActive())
+	const int32 LODLevel = Mesh->GetPredictedLODLevel();
+	if (LODLevel <= Compiled.LODThreshold)
 	{
-		OwnerPawn = IsValid(GetOwner()) ? Cast<APawn>(GetOwner()) : nullptr;
-		
-		// Call the pre-activate event, which can be overridden in blueprint or C++ to cast and cache the owner
-		PreActivate(bReset);
+		return EHitReactTier::Full;
 	}
-	
-	// Cache anything we need from the owner
-	if (Mesh != GetMeshFromOwner() || PhysicalAnimation != GetPhysicalAnimationComponentFromOwner() || bReset)
+
+	// Beyond the LOD threshold, fall back to the spring if allowed
+	const FHitReactSpringParams& SpringParams = Compiled.Spring;
+	if (SpringParams.bEnableSpring && (SpringParams.SpringLODThreshold < 0 || LODLevel <= SpringParams.SpringLODThreshold))
 	{
-		// Unbind from the old mesh
-		if (PhysicalAnimation && Mesh && PhysicalAnimation->GetSkeletalMesh() == Mesh)
-		{
-			PhysicalAnimation->SetSkeletalMeshComponent(nullptr);
-		}
+		return EHitReactTier::Spring;
+	}
 
-		// Cache the new mesh and physical animation
-		Mesh = GetMeshFromOwner();
-		PhysicalAnimation = GetPhysicalAnimationComponentFromOwner();
+	return EHitReactTier::None;
+}
 
-		// Bind to the new mesh
+USkeletalMeshComponent* UHitReact::GetMeshFromOwner_Implementation() const
+{
+	// Default implementation, override in subclass or blueprint
+	// By default, get the first found skeletal mesh component
+	// For ACharacter, this is always ACharacter::Mesh, because it overrides FindComponentByClass() to return it
+	return GetOwner()->GetComponentByClass<USkeletalMeshComponent>();
+}
+
+UPhysicalAnimationComponent* UHitReact::GetPhysicalAnimationComponentFromOwner_Implementation() const
+{
+	// We don't need to have this component
+	return GetOwner()->GetComponentByClass<UPhysicalAnimationComponent>();
+}
+
+void UHitReact::RecycleHitReact()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::RecycleHitReact);
+
+	// Clear the active state, only touching what our hit reacts modified
+	ResetHitReactSystem();
+	PendingImpulse = {};
+	DeferredHitReact = {};
+	SmoothedBoneWeights.Reset();
+
+	// Clear the cooldowns
+	LastHitReactTime = -1.f;
+	LastProfileHitReactTimes.Reset();
+	LastChannelHitReactTimes.Reset();
+
+	// Rebind only if the pool handed us a different mesh or physics asset
+	USkeletalMeshComponent* NewMesh = GetMeshFromOwner();
+	UPhysicalAnimationComponent* NewPhysicalAnimation = GetPhysicalAnimationComponentFromOwner();
+	const UPhysicsAsset* NewPhysicsAsset = NewMesh ? NewMesh->GetPhysicsAsset() : nullptr;
+	if (NewMesh != Mesh || NewPhysicalAnimation != PhysicalAnimation || NewPhysicsAsset != BoundPhysicsAsset.Get())
+	{
+		UnbindFromMesh();
+
+		Mesh = NewMesh;
+		PhysicalAnimation = NewPhysicalAnimation;
 		if (PhysicalAnimation)
 		{
 			PhysicalAnimation->SetSkeletalMeshComponent(Mesh);
 		}
-	}
 
-	if (IsValid(Mesh))
-	{
-		Super::Activate(bReset);
-		if (IsActive() && (!bWasActive || bReset))
+		if (bHasInitialized && IsValid(Mesh))
 		{
-			// Load the profiles
-			bProfilesLoaded = false;
-			ActiveProfiles.Empty();
-			CancelAsyncLoading();
-			for (TSoftObjectPtr<UHitReactProfile>& ProfilePtr : AvailableProfiles)
-			{
-				if (ProfilePtr.IsNull()) { continue; }
-				AsyncLoad(ProfilePtr, [this, InnerSoftProfile = MoveTemp(ProfilePtr)]() 
-				{
-					ActiveProfiles.Add(InnerSoftProfile.Get());
-				});
-			}
-			for (TSoftObjectPtr<UHitReactBoneData>& BoneDataPtr : AvailableBoneData)
+			BindToMesh();
+			if (Backend == EHitReactBackend::Physics && PhysicsResidency.Policy == EHitReactPhysicsResidency::Prewarm)
 			{
-				if (BoneDataPtr.IsNull()) { continue; }
-				AsyncLoad(BoneDataPtr, [this, InnerSoftBoneData = MoveTemp(BoneDataPtr)]() 
-				{
-					ActiveBoneData.Add(InnerSoftBoneData.Get());
-				});
+				MakePhysicsResident();
 			}
-			StartAsyncLoading();
 		}
 	}
-	else
+	else if (PhysicsResidency.Policy == EHitReactPhysicsResidency::Lazy)
 	{
-		const FString ErrorString = FString::Printf(TEXT(
-			"HitReactComponent: Mesh attempted initialization before valid for %s. System will not run."),
-			*GetOwner()->GetName());
-#if !UE_BUILD_SHIPPING
-		FMessageLog("PIE").Error(FText::FromString(ErrorString));
-#else
-		UE_LOG(LogHitReact, Error, TEXT("%s"), *ErrorString);
-#endif
+		// Don't leave an idle timer running while pooled
+		ReleasePhysicsResidency();
 	}
-}
 
-void UHitReact::Deactivate()
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::Deactivate);
-	
-	Super::Deactivate();
-
-	bHasInitialized = false;
-	bProfilesLoaded = false;
-	if (!IsActive())
+	// Nothing to do until the next hit react
+	if (bHasInitialized)
 	{
-		ResetHitReactSystem();
+		SleepHitReact();
 	}
 }
 
-void UHitReact::OnFinishedLoading()
+void UHitReact::BindToMesh()
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::OnFinishedLoading);
-	
-	bProfilesLoaded = true;
-	bHasInitialized = true;
-			
 	// Bind to the mesh's OnAnimInitialized event
 	if (Mesh->OnAnimInitialized.IsAlreadyBound(this, &ThisClass::OnMeshPoseInitialized))
 	{
@@ -1029,159 +2649,189 @@ void UHitReact::OnFinishedLoading()
 	}
 	Mesh->OnAnimInitialized.AddDynamic(this, &ThisClass::OnMeshPoseInitialized);
 
-	// Initialize the tick function
-	PrimaryComponentTick.bAllowTickOnDedicatedServer = bApplyHitReactOnDedicatedServer;
-	PrimaryComponentTick.GetPrerequisites().Reset();
-	AddTickPrerequisiteComponent(Mesh);
-	PrimaryComponentTick.SetTickFunctionEnable(true);
-
-	// Limit tick rate
-	if (bUseFixedSimulationRate)
+	// Bind to the mesh's physics state changes, so we never send commands to bodies that no longer exist
+	if (Mesh->OnComponentPhysicsStateChanged.IsAlreadyBound(this, &ThisClass::OnMeshPhysicsStateChanged))
 	{
-		PrimaryComponentTick.TickInterval = 1.f / FMath::Max(1.f, SimulationRate);
+		Mesh->OnComponentPhysicsStateChanged.RemoveDynamic(this, &ThisClass::OnMeshPhysicsStateChanged);
 	}
-	
-	// Initialize the global alpha interpolation
-	GlobalToggle.State.BlendParams = GlobalToggle.Params;  // Use the default parameters
-	GlobalToggle.State.Initialize(true);
+	Mesh->OnComponentPhysicsStateChanged.AddDynamic(this, &ThisClass::OnMeshPhysicsStateChanged);
 
-	// Broadcast the initialization event
-	for (const TSharedRef<FOnHitReactInitialized>& Delegate : RegisteredInitDelegates)
-	{
-		Delegate->Execute();
-	}
+	// Tick after the mesh
+	AddTickPrerequisiteComponent(Mesh);
+
+	BoundPhysicsAsset = Mesh->GetPhysicsAsset();
 }
 
-bool UHitReact::OnHitReactInitialized(FOnHitReactInitialized Delegate)
+void UHitReact::UnbindFromMesh()
 {
-	if (ensure(Delegate.IsBound()))
+	// Revert the collision on the old mesh
+	ReleasePhysicsResidency();
+
+	if (PhysicalAnimation && Mesh && PhysicalAnimation->GetSkeletalMesh() == Mesh)
 	{
-		if (bHasInitialized)
-		{
-			Delegate.Execute();
-		}
-		else
-		{
-			const TSharedRef<FOnHitReactInitialized> SharedDelegate = MakeShared<FOnHitReactInitialized>(MoveTemp(Delegate));
-			RegisteredInitDelegates.Add(SharedDelegate);
-		}
+		PhysicalAnimation->SetSkeletalMeshComponent(nullptr);
+	}
 
-		return true;
+	if (Mesh)
+	{
+		Mesh->OnAnimInitialized.RemoveDynamic(this, &ThisClass::OnMeshPoseInitialized);
+		Mesh->OnComponentPhysicsStateChanged.RemoveDynamic(this, &ThisClass::OnMeshPhysicsStateChanged);
+		RemoveTickPrerequisiteComponent(Mesh);
+		UHitReactStatics::ResetWeightedBodies(Mesh);
 	}
 
-	return false;
+	BoundPhysicsAsset.Reset();
+	BodyLookup.Reset();
 }
 
-void UHitReact::ToggleHitReactSystem(bool bEnabled, bool bInterpolateState, bool bUseDefaultBlendParams,
-	FHitReactPhysicsStateParamsSimple BlendParams)
+void UHitReact::OnMeshPoseInitialized()
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ToggleHitReactSystem);
-
-	// Dedicated servers don't need cosmetic hit reacts - unless perhaps you're doing some kind of replay system
-	if (GetNetMode() == NM_DedicatedServer && !bApplyHitReactOnDedicatedServer)
-	{
-		return;
-	}
+	ResetHitReactSystem();
+}
 
-	// Set the global alpha interpolation parameters if we're interpolating
-	if (bInterpolateState)
-	{
-		const FHitReactPhysicsStateParamsSimple& Params = bUseDefaultBlendParams ? GlobalToggle.Params : BlendParams;
-		GlobalToggle.State.BlendParams = Params;
-	}
-	
-	// Only if the state changed
-	if (GlobalToggle.State.bToggleEnabled != bEnabled)
+void UHitReact::OnMeshPhysicsStateChanged(UPrimitiveComponent* ChangedComponent, EComponentPhysicsStateChange StateChange)
+{
+	// Commands queued this frame still point at the bodies being destroyed, and their weights go with them
+	if (StateChange == EComponentPhysicsStateChange::Destroyed)
 	{
-		GlobalToggle.State.bToggleEnabled = bEnabled;
-		WakeHitReact();
-		OnHitReactToggleStateChanged.Broadcast(GetHitReactToggleState());
+		AsyncPhysics.DropCommands(ChangedComponent);
+		UHitReactStatics::ResetWeightedBodies(Mesh);
 	}
 }
 
-EHitReactToggleState UHitReact::GetHitReactToggleState() const
+void UHitReact::ResetHitReactSystem()
 {
-	if (GlobalToggle.State.HasCompleted())
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ResetHitReactSystem);
+
+	PhysicsBlends.Reset();
+
+	// Only restore the bodies we modified, other systems may own the rest
+	if (Mesh && TouchedBones.Num() > 0)
 	{
-		return GlobalToggle.State.bToggleEnabled ? EHitReactToggleState::Enabled : EHitReactToggleState::Disabled;
+		RestoreTouchedBodies();
+		UHitReactStatics::FinalizeMeshPhysics(Mesh);
 	}
-		
-	return GlobalToggle.State.bToggleEnabled ? EHitReactToggleState::Enabling : EHitReactToggleState::Disabling;
+
+	// The cached profiles describe the old pose, so don't let them skip applying profiles again
+	RestoreProfiles();
+
+	AnimBoneWeights.Reset();
+	AnimImpulses.Reset();
+	ReactingBoneWeights.Reset();
+	StrongestReactingBone = NAME_None;
+
+	SimulationTimeAccumulator = 0.f;
+	PreviousBoneWeights.Reset();
+	SimulatedBoneWeights.Reset();
+
+	SpringBlends.Reset();
+	SpringBoneRotations.Reset();
 }
 
-bool UHitReact::ShouldSleep() const
+void UHitReact::RestoreTouchedBodies()
 {
-	if (!bHasInitialized || !bProfilesLoaded || ActiveProfiles.Num() == 0)
-	{
-		return true;
-	}
-	if (IsHitReactSystemToggleInProgress())
-	{
-		return false;
-	}
-	if (PhysicsBlends.Num() == 0)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::RestoreTouchedBodies);
+
+	if (Mesh)
 	{
-		return true;
+		for (const FName& BoneName : TouchedBones)
+		{
+			UHitReactStatics::SetBlendWeight(Mesh, BoneName, 0.f);
+		}
 	}
-	return false;
+	TouchedBones.Reset();
 }
 
-bool UHitReact::IsSleeping() const
+void UHitReact::ApplyConstraintProfileBelow(const FName& BoneName, bool bIncludeSelf, const FName& ProfileName)
 {
-	return bHasInitialized && !PrimaryComponentTick.IsTickFunctionEnabled();
-}
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ApplyConstraintProfileBelow);
 
-void UHitReact::WakeHitReact()
-{
-	if (IsSleeping())
+	// Gather the bones in the subtree that don't already use this profile
+	TSet<FName> ChangedBones;
+	ForEachBone(BoneName, bIncludeSelf, [this, &ProfileName, &ChangedBones](const FName& ChildBoneName)
 	{
-		PrimaryComponentTick.SetTickFunctionEnable(true);
+		FName& ActiveProfile = ActiveConstraintProfiles.FindOrAdd(ChildBoneName);
+		if (ActiveProfile != ProfileName)
+		{
+			ActiveProfile = ProfileName;
+			ChangedBones.Add(ChildBoneName);
+		}
+		return true;  // Continue to the next bone
+	});
+
+	// Already applied, e.g. rapid re-hits with the same profile
+	if (ChangedBones.Num() == 0)
+	{
+		return;
 	}
-}
 
-void UHitReact::SleepHitReact()
-{
-	PrimaryComponentTick.SetTickFunctionEnable(false);
+	// Same as USkeletalMeshComponent::SetConstraintProfile but for many joints in a single pass
+	UPhysicsAsset* const PhysicsAsset = Mesh->GetPhysicsAsset();
+	for (int32 ConstraintIdx = 0; ConstraintIdx < Mesh->Constraints.Num(); ConstraintIdx++)
+	{
+		FConstraintInstance* ConstraintInstance = Mesh->Constraints[ConstraintIdx];
+		if (ConstraintInstance && ChangedBones.Contains(ConstraintInstance->JointName) && PhysicsAsset->ConstraintSetup.IsValidIndex(ConstraintIdx))
+		{
+			PhysicsAsset->ConstraintSetup[ConstraintIdx]->ApplyConstraintProfile(ProfileName, *ConstraintInstance, false);
+		}
+	}
 }
 
-bool UHitReact::NeedsCollisionEnabled() const
+void UHitReact::ApplyPhysicalAnimProfileBelow(const FName& BoneName, bool bIncludeSelf, const FName& ProfileName)
 {
-	return Mesh->GetCollisionEnabled() != ECollisionEnabled::QueryAndPhysics && Mesh->GetCollisionEnabled() != ECollisionEnabled::PhysicsOnly;
-}
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ApplyPhysicalAnimProfileBelow);
 
-USkeletalMeshComponent* UHitReact::GetMeshFromOwner_Implementation() const
-{
-	// Default implementation, override in subclass or blueprint
-	// By default, get the first found skeletal mesh component
-	// For ACharacter, this is always ACharacter::Mesh, because it overrides FindComponentByClass() to return it
-	return GetOwner()->GetComponentByClass<USkeletalMeshComponent>();
-}
+	// Same as UPhysicalAnimationComponent::ApplyPhysicalAnimationProfileBelow but skips bones that already use this profile
+	const UPhysicsAsset* PhysicsAsset = Mesh->GetPhysicsAsset();
+	ForEachBone(BoneName, bIncludeSelf, [this, &ProfileName, &PhysicsAsset](const FName& ChildBoneName)
+	{
+		FName& ActiveProfile = ActivePhysicalAnimProfiles.FindOrAdd(ChildBoneName);
+		if (ActiveProfile == ProfileName)
+		{
+			return true;  // Continue to the next bone
+		}
+		ActiveProfile = ProfileName;
 
-UPhysicalAnimationComponent* UHitReact::GetPhysicalAnimationComponentFromOwner_Implementation() const
-{
-	// We don't need to have this component
-	return GetOwner()->GetComponentByClass<UPhysicalAnimationComponent>();
+		const int32 BodyIndex = PhysicsAsset->FindBodyIndex(ChildBoneName);
+		const USkeletalBodySetup* BodySetup = BodyIndex != INDEX_NONE ? PhysicsAsset->SkeletalBodySetups[BodyIndex].Get() : nullptr;
+		if (const FPhysicalAnimationProfile* Profile = BodySetup ? BodySetup->FindPhysicalAnimationProfile(ProfileName) : nullptr)
+		{
+			PhysicalAnimation->ApplyPhysicalAnimationSettings(ChildBoneName, Profile->PhysicalAnimationData);
+		}
+		return true;  // Continue to the next bone
+	});
 }
 
-void UHitReact::OnMeshPoseInitialized()
+void UHitReact::RestoreProfiles()
 {
-	ResetHitReactSystem();
-}
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::RestoreProfiles);
 
-void UHitReact::ResetHitReactSystem()
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ResetHitReactSystem);
+	// Revert to the default constraint profile
+	if (ActiveConstraintProfiles.Num() > 0 && Mesh && Mesh->GetPhysicsAsset())
+	{
+		UPhysicsAsset* const PhysicsAsset = Mesh->GetPhysicsAsset();
+		for (int32 ConstraintIdx = 0; ConstraintIdx < Mesh->Constraints.Num(); ConstraintIdx++)
+		{
+			FConstraintInstance* ConstraintInstance = Mesh->Constraints[ConstraintIdx];
+			if (ConstraintInstance && ActiveConstraintProfiles.Contains(ConstraintInstance->JointName) && PhysicsAsset->ConstraintSetup.IsValidIndex(ConstraintIdx))
+			{
+				PhysicsAsset->ConstraintSetup[ConstraintIdx]->ApplyConstraintProfile(NAME_None, *ConstraintInstance, true);
+			}
+		}
+	}
+	ActiveConstraintProfiles.Reset();
 
-	if (PhysicsBlends.Num() > 0)
+	// Clear the physical animation drives we added
+	if (PhysicalAnimation)
 	{
-		PhysicsBlends.Reset();
-	
-		if (Mesh)
+		for (const auto& Pair : ActivePhysicalAnimProfiles)
 		{
-			Mesh->SetAllBodiesPhysicsBlendWeight(0.f);
-			Mesh->SetAllBodiesSimulatePhysics(false);
+			FPhysicalAnimationData Data;
+			Data.BodyName = Pair.Key;
+			PhysicalAnimation->ApplyPhysicalAnimationSettings(Pair.Key, Data);
 		}
 	}
+	ActivePhysicalAnimProfiles.Reset();
 }
 
 bool UHitReact::ShouldCVarDrawDebug(int32 CVarValue) const
@@ -1211,7 +2861,16 @@ bool UHitReact::IsLocallyControlledPlayer() const
 	return OwnerPawn && OwnerPawn->GetController<APlayerController>() && OwnerPawn->IsLocallyControlled();
 }
 
-void UHitReact::DebugHitReactResult(const FString& Result, bool bFailed) const
+bool UHitReact::ShouldDebugHitReactResult() const
+{
+#if UE_ENABLE_DEBUG_DRAWING
+	return ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactResult);
+#else
+	return false;
+#endif
+}
+
+void UHitReact::DebugHitReactResult(FStringView Result, bool bFailed) const
 {
 #if UE_ENABLE_DEBUG_DRAWING
 	if (!ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactResult))
@@ -1223,13 +2882,13 @@ void UHitReact::DebugHitReactResult(const FString& Result, bool bFailed) const
 	const FString OwnerName = GetOwner() ? GetOwner()->GetName() : TEXT("Unknown");
 	const FColor DebugColor = bFailed ? FColor::Red : FColor::Green;
 	GEngine->AddOnScreenDebugMessage(-1, 2.4f, DebugColor, FString::Printf(
-		TEXT("HitReact: %s - HitReact(): %s"), *OwnerName, *Result));
+		TEXT("HitReact: %s - HitReact(): %.*s"), *OwnerName, Result.Len(), Result.GetData()));
 #endif
 
 #if WITH_EDITOR
 	if (bFailed)
 	{
-		const FString ErrorString = FString::Printf(TEXT("HitReact: %s - HitReact(): %s"), *OwnerName, *Result);
+		const FString ErrorString = FString::Printf(TEXT("HitReact: %s - HitReact(): %.*s"), *OwnerName, Result.Len(), Result.GetData());
 		FMessageLog("PIE").Error(FText::FromString(ErrorString));
 	}
 #endif
@@ -1270,6 +2929,13 @@ EDataValidationResult UHitReact::IsDataValid(class FDataValidationContext& Conte
 			{
 				ProfileNames.Add(AssetName);
 			}
+
+			// Unregistered entries replicate as a full asset path
+			if (!FHitReactNetRegistry::Get().IsProfileRegistered(ProfilePtr.ToSoftObjectPath()))
+			{
+				Context.AddWarning(FText::Format(LOCTEXT("UnregisteredProfile", "Profile {0} is not in the HitReact NetProfiles project settings and will replicate as a full asset path"),
+					FText::FromString(AssetName)));
+			}
 		}
 	}
 
@@ -1295,6 +2961,13 @@ EDataValidationResult UHitReact::IsDataValid(class FDataValidationContext& Conte
 			{
 				BoneDataNames.Add(AssetName);
 			}
+
+			// Unregistered entries replicate as a full asset path
+			if (!FHitReactNetRegistry::Get().IsBoneDataRegistered(BoneDataPtr.ToSoftObjectPath()))
+			{
+				Context.AddWarning(FText::Format(LOCTEXT("UnregisteredBoneData", "Bone data {0} is not in the HitReact NetBoneData project settings and will replicate as a full asset path"),
+					FText::FromString(AssetName)));
+			}
 		}
 	}
 	
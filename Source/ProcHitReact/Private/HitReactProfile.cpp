@@ -9,6 +9,58 @@
 
 #define LOCTEXT_NAMESPACE "HitReactProfile"
 
+const FHitReactCompiledProfile& UHitReactProfile::GetCompiled() const
+{
+	return *FHitReactProfileTable::Get().Find(GetCompiledHandle());
+}
+
+FHitReactCompiledProfilePtr UHitReactProfile::GetCompiledShared() const
+{
+	return FHitReactProfileTable::Get().FindShared(GetCompiledHandle());
+}
+
+FHitReactProfileHandle UHitReactProfile::GetCompiledHandle() const
+{
+	if (!CompiledHandle.IsValid())
+	{
+		CompiledHandle = FHitReactProfileTable::Get().Compile(this);
+	}
+	return CompiledHandle;
+}
+
+void UHitReactProfile::PostLoad()
+{
+	Super::PostLoad();
+
+	// Compile now rather than on the first hit react, reusing our slot if we're being reloaded
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		CompiledHandle = FHitReactProfileTable::Get().Compile(this, CompiledHandle);
+	}
+}
+
+void UHitReactProfile::BeginDestroy()
+{
+	// Free our slot, active hit reacts keep their compiled profile until they end
+	if (CompiledHandle.IsValid())
+	{
+		FHitReactProfileTable::Get().Release(CompiledHandle);
+		CompiledHandle = {};
+	}
+
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void UHitReactProfile::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Compiled profiles are immutable, recompile into our slot, active hit reacts keep using the previous one
+	CompiledHandle = FHitReactProfileTable::Get().Compile(this, CompiledHandle);
+}
+#endif
+
 #if WITH_EDITOR
 #if UE_5_03_OR_LATER
 EDataValidationResult UHitReactProfile::IsDataValid(class FDataValidationContext& Context) const
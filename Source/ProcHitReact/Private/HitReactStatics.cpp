@@ -4,6 +4,7 @@
 #include "HitReactStatics.h"
 
 #include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/SkeletalMesh.h"
 #include "Logging/MessageLog.h"
@@ -12,8 +13,54 @@
 
 #define LOCTEXT_NAMESPACE "HitReactStatics"
 
+namespace HitReactStatics
+{
+	/** Weighted bodies set by SetBlendWeight for a single mesh */
+	struct FMeshWeightedBodies
+	{
+		/** Number of bodies with a PhysicsBlendWeight above zero */
+		int32 NumWeightedBodies = 0;
+
+		/** Changed between zero and non-zero weighted bodies since the last FinalizeMeshPhysics */
+		bool bDirty = false;
+	};
+
+	/** Game thread only */
+	static TMap<TObjectKey<USkeletalMeshComponent>, FMeshWeightedBodies> MeshWeightedBodies;
+
+	/**
+	 * Find the tracked bodies for the mesh, counting them from the mesh if we aren't tracking it yet
+	 * A rebuilt entry is dirty because we don't know what the tick registration was last updated with
+	 */
+	static FMeshWeightedBodies& FindOrRebuild(const USkeletalMeshComponent* Mesh)
+	{
+		if (FMeshWeightedBodies* Tracked = MeshWeightedBodies.Find(Mesh))
+		{
+			return *Tracked;
+		}
+
+		FMeshWeightedBodies& Tracked = MeshWeightedBodies.Add(Mesh);
+		for (const FBodyInstance* Body : Mesh->Bodies)
+		{
+			if (Body && Body->PhysicsBlendWeight > 0.f)
+			{
+				Tracked.NumWeightedBodies++;
+			}
+		}
+		Tracked.bDirty = true;
+		return Tracked;
+	}
+}
+
 bool UHitReactStatics::DoAnyPhysicsBodiesHaveWeight(const USkeletalMeshComponent* Mesh)
 {
+	// Skip the scan if we already know
+	const HitReactStatics::FMeshWeightedBodies* Tracked = HitReactStatics::MeshWeightedBodies.Find(Mesh);
+	if (Tracked && Tracked->NumWeightedBodies > 0)
+	{
+		return true;
+	}
+
 	for (const FBodyInstance* Body : Mesh->Bodies)
 	{
 		if (Body && Body->PhysicsBlendWeight > 0.f)
@@ -115,8 +162,51 @@ int32 UHitReactStatics::ForEach(USkeletalMeshComponent* Mesh, FName BoneName, bo
 	}
 }
 
+int32 UHitReactStatics::ForEachBodySetup(const USkeletalMeshComponent* Mesh, FName BoneName, bool bIncludeSelf,
+	const TFunctionRef<bool(const FName&)>& Func)
+{
+	UPhysicsAsset* const PhysicsAsset = Mesh ? Mesh->GetPhysicsAsset() : nullptr;
+	if (!PhysicsAsset || !Mesh->GetSkeletalMeshAsset())
+	{
+		return 0;
+	}
+
+	TArray<int32> BodyIndices;
+	if (BoneName == NAME_None && bIncludeSelf)
+	{
+		for (int32 BodyIdx = 0; BodyIdx < PhysicsAsset->SkeletalBodySetups.Num(); BodyIdx++)
+		{
+			BodyIndices.Add(BodyIdx);
+		}
+	}
+	else
+	{
+		PhysicsAsset->GetBodyIndicesBelow(BodyIndices, BoneName, Mesh->GetSkeletalMeshAsset(), bIncludeSelf);
+	}
+
+	int32 NumBodiesFound = 0;
+	for (const int32 BodyIdx : BodyIndices)
+	{
+		const USkeletalBodySetup* BodySetup = PhysicsAsset->SkeletalBodySetups[BodyIdx];
+		if (!BodySetup)
+		{
+			continue;
+		}
+
+		++NumBodiesFound;
+		if (!Func(BodySetup->BoneName)) // Early exit if lambda returns false
+		{
+			return NumBodiesFound;
+		}
+	}
+
+	return NumBodiesFound;
+}
+
 void UHitReactStatics::FinalizeMeshPhysics(USkeletalMeshComponent* Mesh)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactStatics::FinalizeMeshPhysics);
+
 	if (Mesh->IsSimulatingPhysics())
 	{
 		Mesh->SetRootBodyIndex(Mesh->RootBodyData.BodyIndex);	//Update the root body data cache in case animation has moved root body relative to root joint
@@ -124,10 +214,23 @@ void UHitReactStatics::FinalizeMeshPhysics(USkeletalMeshComponent* Mesh)
 	
 	Mesh->bBlendPhysics = false;
 
+	// Tick registration only changes when bodies gain or lose all weight
+	HitReactStatics::FMeshWeightedBodies& Tracked = HitReactStatics::FindOrRebuild(Mesh);
+	if (!Tracked.bDirty)
+	{
+		return;
+	}
+
+	Tracked.bDirty = false;
 	UpdateEndPhysicsTickRegisteredState(Mesh);
 	UpdateClothTickRegisteredState(Mesh);
 }
 
+void UHitReactStatics::ResetWeightedBodies(const USkeletalMeshComponent* Mesh)
+{
+	HitReactStatics::MeshWeightedBodies.Remove(Mesh);
+}
+
 bool UHitReactStatics::AccumulateBlendWeight(const USkeletalMeshComponent* Mesh, const FName& BoneName,
 	float BlendWeight, float ClampBlendWeight, float Alpha)
 {
@@ -151,6 +254,8 @@ bool UHitReactStatics::SetBlendWeight(const USkeletalMeshComponent* Mesh, const
 		return false;
 	}
 
+	const bool bHadWeight = BI->PhysicsBlendWeight > 0.f;
+
 	// Clamp the blend weight
 	BI->PhysicsBlendWeight = FMath::Clamp(BlendWeight, 0.f, ClampBlendWeight);
 
@@ -167,6 +272,20 @@ bool UHitReactStatics::SetBlendWeight(const USkeletalMeshComponent* Mesh, const
 		BI->PhysicsBlendWeight = 0.f;
 	}
 
+	// Track the number of weighted bodies so FinalizeMeshPhysics only does work on transitions
+	// Untracked meshes are counted from their bodies by the next FinalizeMeshPhysics instead
+	const bool bHasWeight = BI->PhysicsBlendWeight > 0.f;
+	HitReactStatics::FMeshWeightedBodies* Tracked = bHadWeight != bHasWeight ? HitReactStatics::MeshWeightedBodies.Find(Mesh) : nullptr;
+	if (Tracked)
+	{
+		const bool bWasWeighted = Tracked->NumWeightedBodies > 0;
+		Tracked->NumWeightedBodies = FMath::Max(0, Tracked->NumWeightedBodies + (bHasWeight ? 1 : -1));
+		if (bWasWeighted != Tracked->NumWeightedBodies > 0)
+		{
+			Tracked->bDirty = true;
+		}
+	}
+
 	// Set simulate physics if necessary
 	const bool bWantsSim = BI->PhysicsBlendWeight > 0.f;
 	if (bWantsSim != BI->bSimulatePhysics)
@@ -19,4 +19,8 @@ namespace FHitReactTags
 	UE_DEFINE_GAMEPLAY_TAG_COMMENT(HitReact_Profile_Twitch_NoLegs, "HitReact.Profile.Twitch.NoLegs", "Designed for rapid re-application of hit reacts, such as taking multiple shots from a fast firing weapon, while ignoring leg bones");
 	UE_DEFINE_GAMEPLAY_TAG_COMMENT(HitReact_Profile_Twitch_NoLimbs, "HitReact.Profile.Twitch.NoLimbs", "Designed for rapid re-application of hit reacts, such as taking multiple shots from a fast firing weapon, while ignoring arm and leg bones");
 	UE_DEFINE_GAMEPLAY_TAG_COMMENT(HitReact_Profile_Flop, "HitReact.Profile.Flop", "Makes the character as floppy as possible, primarily for testing purposes");
+
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(HitReact_Channel_Locomotion, "HitReact.Channel.Locomotion", "Cheap reactions from movement, such as bumping into other pawns");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(HitReact_Channel_Damage, "HitReact.Channel.Damage", "Reactions to taking damage from weapons and projectiles");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(HitReact_Channel_Explosion, "HitReact.Channel.Explosion", "Reactions to explosions and other radial impulses");
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Net/HitReactEventBuffer.h"
+
+#include "HitReact.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactEventBuffer)
+
+void FHitReactEventItem::SetEvent(const FHitReactTrigger& InTrigger, const FHitReactImpulse_WorldParams& InWorld,
+	float InImpulseScalar, float InServerTime)
+{
+	Trigger = InTrigger;
+	World = InWorld;
+	ImpulseScalar = InImpulseScalar;
+	ServerTime = InServerTime;
+	NumCoalesced = 1;
+}
+
+void FHitReactEventItem::PostReplicatedAdd(const FHitReactEventBuffer& InArraySerializer)
+{
+	if (InArraySerializer.OwnerComponent)
+	{
+		InArraySerializer.OwnerComponent->OnReplicatedHitReactEvent(*this);
+	}
+}
+
+void FHitReactEventItem::PostReplicatedChange(const FHitReactEventBuffer& InArraySerializer)
+{
+	if (InArraySerializer.OwnerComponent)
+	{
+		InArraySerializer.OwnerComponent->OnReplicatedHitReactEvent(*this);
+	}
+}
+
+void FHitReactEventBuffer::AddEvent(const FHitReactTrigger& Trigger, const FHitReactImpulse_WorldParams& World,
+	float ImpulseScalar, float ServerTime, int32 MaxEvents, float CoalesceWindow)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactEventBuffer::AddEvent);
+
+	// Merge into the most recent event if it is still within the window
+	if (CoalesceWindow > 0.f && Items.IsValidIndex(LastIndex))
+	{
+		FHitReactEventItem& Last = Items[LastIndex];
+		if (ServerTime - Last.ServerTime < CoalesceWindow && Last.Trigger.Profile == Trigger.Profile)
+		{
+			// The window is measured from the first event, so a constant stream still produces new events
+			const float LastServerTime = Last.ServerTime;
+			const float LastImpulseScalar = Last.ImpulseScalar;
+			const uint8 LastNumCoalesced = Last.NumCoalesced;
+
+			// Newest hit wins, at the strongest impulse of the burst
+			Last.SetEvent(Trigger, World, FMath::Max(ImpulseScalar, LastImpulseScalar), LastServerTime);
+			Last.NumCoalesced = LastNumCoalesced < MAX_uint8 ? LastNumCoalesced + 1 : MAX_uint8;
+			MarkItemDirty(Last);
+			return;
+		}
+	}
+
+	// Grow until we reach capacity, then overwrite the oldest slot
+	const int32 Capacity = FMath::Max(1, MaxEvents);
+	if (Items.Num() < Capacity)
+	{
+		LastIndex = Items.AddDefaulted();
+	}
+	else
+	{
+		LastIndex = (LastIndex + 1) % Items.Num();
+	}
+
+	FHitReactEventItem& Item = Items[LastIndex];
+	Item.SetEvent(Trigger, World, ImpulseScalar, ServerTime);
+	MarkItemDirty(Item);
+}
@@ -0,0 +1,910 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Net/HitReactNetSerializers.h"
+
+#if UE_WITH_IRIS
+#include "Iris/ReplicationState/PropertyNetSerializerInfoRegistry.h"
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamUtil.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializerDelegates.h"
+#include "Params/HitReactTrigger.h"
+#include "System/HitReactNetRegistry.h"
+
+namespace UE::Net::HitReactNetSerializer
+{
+	/** Bit-packed impulse flags, only the bits relevant to the impulse type are written */
+	enum EImpulseFlags : uint8
+	{
+		Flag_Apply			= 1 << 0,
+		Flag_FactorMass		= 1 << 1,
+		Flag_Radians		= 1 << 2,
+		Flag_Constant		= 1 << 3,
+	};
+
+	/** Longest name or path we will accept when an entry is not in FHitReactNetRegistry */
+	static constexpr uint32 MaxStringLength = 1024;
+
+	/*
+	 * Quantized state
+	 * Must be trivially copyable, FName and FTopLevelAssetPath don't own any memory
+	 */
+
+	struct FQuantizedImpulse
+	{
+		float Impulse;
+		uint8 Flags;
+	};
+
+	struct FQuantizedImpulse_Angular
+	{
+		FQuantizedImpulse Base;
+	};
+
+	struct FQuantizedImpulse_Radial
+	{
+		FQuantizedImpulse Base;
+		float Radius;
+	};
+
+	struct FQuantizedImpulseParams
+	{
+		FQuantizedImpulse Linear;
+		FQuantizedImpulse_Angular Angular;
+		FQuantizedImpulse_Radial Radial;
+	};
+
+	struct FQuantizedWorldParams
+	{
+		uint16 LinearDirection[3];
+		uint16 AngularDirection[3];
+		double RadialLocation[3];
+	};
+
+	struct FQuantizedInputParams
+	{
+		FTopLevelAssetPath Profile;
+		FName ProfileTag;
+		FTopLevelAssetPath BoneData;
+		FName SimulatedBoneName;
+		FName ImpulseBoneName;
+		uint8 bIncludeSelf;
+	};
+
+	template<typename ImpulseType>
+	struct TQuantizedTrigger
+	{
+		FQuantizedInputParams Input;
+		ImpulseType Impulse;
+	};
+
+	/*
+	 * Bit stream primitives
+	 */
+
+	static void WriteFloat(FNetBitStreamWriter* Writer, float Value)
+	{
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		Writer->WriteBits(Bits, 32U);
+	}
+
+	static float ReadFloat(FNetBitStreamReader* Reader)
+	{
+		const uint32 Bits = Reader->ReadBits(32U);
+		float Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	static void WriteDouble(FNetBitStreamWriter* Writer, double Value)
+	{
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		Writer->WriteBits(static_cast<uint32>(Bits), 32U);
+		Writer->WriteBits(static_cast<uint32>(Bits >> 32U), 32U);
+	}
+
+	static double ReadDouble(FNetBitStreamReader* Reader)
+	{
+		const uint64 Low = Reader->ReadBits(32U);
+		const uint64 High = Reader->ReadBits(32U);
+		const uint64 Bits = Low | (High << 32U);
+		double Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	/**
+	 * Unit vector components as 16-bit fixed point, the same as WriteFixedCompressedFloat<1, 16>()
+	 * so that we match the legacy SerializeFixedVector<1, 16>() and FVector_NetQuantizeNormal
+	 */
+	static constexpr int32 UnitFloatMaxBitValue = (1 << 15) - 1;
+	static constexpr int32 UnitFloatBias = 1 << 15;
+
+	static uint16 QuantizeUnitFloat(double Value)
+	{
+		const int32 Scaled = FMath::TruncToInt32(static_cast<float>(UnitFloatMaxBitValue) * static_cast<float>(Value));
+		return static_cast<uint16>(FMath::Clamp<int32>(Scaled + UnitFloatBias, 0, MAX_uint16));
+	}
+
+	static double DequantizeUnitFloat(uint16 Value)
+	{
+		return static_cast<float>(static_cast<int32>(Value) - UnitFloatBias) * (1.f / static_cast<float>(UnitFloatMaxBitValue));
+	}
+
+	static void WriteString(FNetBitStreamWriter* Writer, const FString& String)
+	{
+		const FTCHARToUTF8 Utf8(*String);
+		const uint32 Length = FMath::Min<uint32>(Utf8.Length(), MaxStringLength);
+		WritePackedUint32(Writer, Length);
+		for (uint32 i = 0; i < Length; i++)
+		{
+			Writer->WriteBits(static_cast<uint8>(Utf8.Get()[i]), 8U);
+		}
+	}
+
+	static FString ReadString(FNetSerializationContext& Context)
+	{
+		FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+		const uint32 Length = ReadPackedUint32(Reader);
+		if (Length > MaxStringLength)
+		{
+			Context.SetError(GNetError_InvalidValue);
+			return FString();
+		}
+
+		TArray<ANSICHAR> Chars;
+		Chars.SetNumUninitialized(Length);
+		for (uint32 i = 0; i < Length; i++)
+		{
+			Chars[i] = static_cast<ANSICHAR>(Reader->ReadBits(8U));
+		}
+
+		const FUTF8ToTCHAR Converted(Chars.GetData(), Length);
+		return FString(Converted.Length(), Converted.Get());
+	}
+
+	/** Registered bones are written as their FHitReactNetRegistry index, otherwise as a string */
+	static void WriteBoneName(FNetBitStreamWriter* Writer, const FName& BoneName)
+	{
+		const int32 NetIndex = BoneName.IsNone() ? 0 : FHitReactNetRegistry::Get().GetBoneNames().Find(BoneName);
+		Writer->WriteBool(NetIndex != INDEX_NONE);
+		if (NetIndex != INDEX_NONE)
+		{
+			WritePackedUint32(Writer, static_cast<uint32>(NetIndex));
+		}
+		else
+		{
+			WriteString(Writer, BoneName.ToString());
+		}
+	}
+
+	static FName ReadBoneName(FNetSerializationContext& Context)
+	{
+		FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+		if (Reader->ReadBool())
+		{
+			const THitReactNetTable<FName>& Table = FHitReactNetRegistry::Get().GetBoneNames();
+			const uint32 NetIndex = ReadPackedUint32(Reader);
+			if (NetIndex == 0)
+			{
+				return NAME_None;
+			}
+			if (!Table.IsValidIndex(NetIndex))
+			{
+				// Tables differ between machines
+				Context.SetError(GNetError_InvalidValue);
+				return NAME_None;
+			}
+			return Table.Entries[NetIndex - 1];
+		}
+		return FName(*ReadString(Context));
+	}
+
+	/** Registered assets are written as their FHitReactNetRegistry index, otherwise as a path */
+	static void WriteAssetPath(FNetBitStreamWriter* Writer, const FTopLevelAssetPath& AssetPath,
+		const THitReactNetTable<FSoftObjectPath>& Table)
+	{
+		const int32 NetIndex = AssetPath.IsNull() ? 0 : Table.Find(FSoftObjectPath(AssetPath));
+		Writer->WriteBool(NetIndex != INDEX_NONE);
+		if (NetIndex != INDEX_NONE)
+		{
+			WritePackedUint32(Writer, static_cast<uint32>(NetIndex));
+		}
+		else
+		{
+			WriteString(Writer, AssetPath.ToString());
+		}
+	}
+
+	static FTopLevelAssetPath ReadAssetPath(FNetSerializationContext& Context, const THitReactNetTable<FSoftObjectPath>& Table)
+	{
+		FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+		if (Reader->ReadBool())
+		{
+			const uint32 NetIndex = ReadPackedUint32(Reader);
+			if (NetIndex == 0)
+			{
+				return FTopLevelAssetPath();
+			}
+			if (!Table.IsValidIndex(NetIndex))
+			{
+				// Tables differ between machines
+				Context.SetError(GNetError_InvalidValue);
+				return FTopLevelAssetPath();
+			}
+			return Table.Entries[NetIndex - 1].GetAssetPath();
+		}
+
+		FTopLevelAssetPath AssetPath;
+		AssetPath.TrySetPath(ReadString(Context));
+		return AssetPath;
+	}
+
+	/** Profiles requested by tag only send the tag, as its gameplay tag net index if networked, otherwise as a name */
+	static void WriteProfileOrTag(FNetBitStreamWriter* Writer, const FQuantizedInputParams& Value)
+	{
+		const bool bHasTag = !Value.ProfileTag.IsNone();
+		Writer->WriteBool(bHasTag);
+		if (!bHasTag)
+		{
+			WriteAssetPath(Writer, Value.Profile, FHitReactNetRegistry::Get().GetProfiles());
+			return;
+		}
+
+		const int32 NetIndex = FHitReactNetRegistry::GetTagNetIndex(FGameplayTag::RequestGameplayTag(Value.ProfileTag, false));
+		Writer->WriteBool(NetIndex != INDEX_NONE);
+		if (NetIndex != INDEX_NONE)
+		{
+			WritePackedUint32(Writer, static_cast<uint32>(NetIndex));
+		}
+		else
+		{
+			WriteString(Writer, Value.ProfileTag.ToString());
+		}
+	}
+
+	static void ReadProfileOrTag(FNetSerializationContext& Context, FQuantizedInputParams& Value)
+	{
+		FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+		if (!Reader->ReadBool())
+		{
+			Value.Profile = ReadAssetPath(Context, FHitReactNetRegistry::Get().GetProfiles());
+			return;
+		}
+
+		if (Reader->ReadBool())
+		{
+			const FGameplayTag Tag = FHitReactNetRegistry::GetTagFromNetIndex(ReadPackedUint32(Reader));
+			if (!Tag.IsValid())
+			{
+				// Tag trees differ between machines
+				Context.SetError(GNetError_InvalidValue);
+			}
+			Value.ProfileTag = Tag.GetTagName();
+			return;
+		}
+		Value.ProfileTag = FName(*ReadString(Context));
+	}
+
+	/*
+	 * Quantize / Dequantize
+	 */
+
+	static void Quantize(const FHitReactImpulse& Source, FQuantizedImpulse& Target)
+	{
+		if (Source.bApplyImpulse)
+		{
+			Target.Flags = Flag_Apply | (Source.bFactorMass ? Flag_FactorMass : 0);
+			Target.Impulse = Source.Impulse;
+		}
+	}
+
+	static void Dequantize(const FQuantizedImpulse& Source, FHitReactImpulse& Target)
+	{
+		Target.bApplyImpulse = (Source.Flags & Flag_Apply) != 0;
+		if (Target.bApplyImpulse)
+		{
+			Target.bFactorMass = (Source.Flags & Flag_FactorMass) != 0;
+			Target.Impulse = Source.Impulse;
+		}
+	}
+
+	static void Quantize(const FHitReactImpulse_Angular& Source, FQuantizedImpulse_Angular& Target)
+	{
+		Quantize(static_cast<const FHitReactImpulse&>(Source), Target.Base);
+		if (Source.bApplyImpulse && Source.AngularUnits == EHitReactUnits::Radians)
+		{
+			Target.Base.Flags |= Flag_Radians;
+		}
+	}
+
+	static void Dequantize(const FQuantizedImpulse_Angular& Source, FHitReactImpulse_Angular& Target)
+	{
+		Dequantize(Source.Base, static_cast<FHitReactImpulse&>(Target));
+		if (Target.bApplyImpulse)
+		{
+			Target.AngularUnits = (Source.Base.Flags & Flag_Radians) ? EHitReactUnits::Radians : EHitReactUnits::Degrees;
+		}
+	}
+
+	static void Quantize(const FHitReactImpulse_Radial& Source, FQuantizedImpulse_Radial& Target)
+	{
+		Quantize(static_cast<const FHitReactImpulse&>(Source), Target.Base);
+		if (Source.bApplyImpulse)
+		{
+			Target.Radius = Source.Radius;
+			Target.Base.Flags |= Source.Falloff == EHitReactFalloff::Constant ? Flag_Constant : 0;
+		}
+	}
+
+	static void Dequantize(const FQuantizedImpulse_Radial& Source, FHitReactImpulse_Radial& Target)
+	{
+		Dequantize(Source.Base, static_cast<FHitReactImpulse&>(Target));
+		if (Target.bApplyImpulse)
+		{
+			Target.Radius = Source.Radius;
+			Target.Falloff = (Source.Base.Flags & Flag_Constant) ? EHitReactFalloff::Constant : EHitReactFalloff::Linear;
+		}
+	}
+
+	static void Quantize(const FHitReactImpulseParams& Source, FQuantizedImpulseParams& Target)
+	{
+		Quantize(Source.LinearImpulse, Target.Linear);
+		Quantize(Source.AngularImpulse, Target.Angular);
+		Quantize(Source.RadialImpulse, Target.Radial);
+	}
+
+	static void Dequantize(const FQuantizedImpulseParams& Source, FHitReactImpulseParams& Target)
+	{
+		Dequantize(Source.Linear, Target.LinearImpulse);
+		Dequantize(Source.Angular, Target.AngularImpulse);
+		Dequantize(Source.Radial, Target.RadialImpulse);
+	}
+
+	static void Quantize(const FHitReactImpulse_WorldParams& Source, FQuantizedWorldParams& Target)
+	{
+		// Directions are unit vectors and quantize well, locations need double precision
+		for (int32 i = 0; i < 3; i++)
+		{
+			Target.LinearDirection[i] = QuantizeUnitFloat(Source.LinearDirection[i]);
+			Target.AngularDirection[i] = QuantizeUnitFloat(Source.AngularDirection[i]);
+			Target.RadialLocation[i] = Source.RadialLocation[i];
+		}
+	}
+
+	static void Dequantize(const FQuantizedWorldParams& Source, FHitReactImpulse_WorldParams& Target)
+	{
+		for (int32 i = 0; i < 3; i++)
+		{
+			Target.LinearDirection[i] = DequantizeUnitFloat(Source.LinearDirection[i]);
+			Target.AngularDirection[i] = DequantizeUnitFloat(Source.AngularDirection[i]);
+			Target.RadialLocation[i] = Source.RadialLocation[i];
+		}
+	}
+
+	static void Quantize(const FHitReactInputParams& Source, FQuantizedInputParams& Target)
+	{
+		Target.Profile = Source.Profile.ToSoftObjectPath().GetAssetPath();
+		Target.ProfileTag = Source.ProfileTag.GetTagName();
+		Target.BoneData = Source.BoneData.ToSoftObjectPath().GetAssetPath();
+		Target.SimulatedBoneName = Source.SimulatedBoneName;
+		Target.ImpulseBoneName = Source.ImpulseBoneName;
+		Target.bIncludeSelf = Source.bIncludeSelf ? 1 : 0;
+	}
+
+	static void Dequantize(const FQuantizedInputParams& Source, FHitReactInputParams& Target)
+	{
+		Target.Profile = TSoftObjectPtr<UHitReactProfile>(FSoftObjectPath(Source.Profile));
+		Target.ProfileTag = FGameplayTag::RequestGameplayTag(Source.ProfileTag, false);
+		Target.BoneData = TSoftObjectPtr<UHitReactBoneData>(FSoftObjectPath(Source.BoneData));
+		Target.SimulatedBoneName = Source.SimulatedBoneName;
+		Target.ImpulseBoneName = Source.ImpulseBoneName;
+		Target.bIncludeSelf = Source.bIncludeSelf != 0;
+	}
+
+	/** Triggers only replicate the profile or its tag, simulated bone and bIncludeSelf, matching the legacy serializers */
+	static void QuantizeTriggerInput(const FHitReactInputParams& Source, FQuantizedInputParams& Target)
+	{
+		Target.Profile = Source.Profile.ToSoftObjectPath().GetAssetPath();
+		Target.ProfileTag = Source.ProfileTag.GetTagName();
+		Target.SimulatedBoneName = Source.SimulatedBoneName;
+		Target.bIncludeSelf = Source.bIncludeSelf ? 1 : 0;
+	}
+
+	static void DequantizeTriggerInput(const FQuantizedInputParams& Source, FHitReactInputParams& Target)
+	{
+		Target.Profile = TSoftObjectPtr<UHitReactProfile>(FSoftObjectPath(Source.Profile));
+		Target.ProfileTag = FGameplayTag::RequestGameplayTag(Source.ProfileTag, false);
+		Target.SimulatedBoneName = Source.SimulatedBoneName;
+		Target.bIncludeSelf = Source.bIncludeSelf != 0;
+	}
+
+	static void Quantize(const FHitReactTrigger& Source, TQuantizedTrigger<FQuantizedImpulseParams>& Target)
+	{
+		QuantizeTriggerInput(Source, Target.Input);
+		Quantize(Source.Impulse, Target.Impulse);
+	}
+
+	static void Dequantize(const TQuantizedTrigger<FQuantizedImpulseParams>& Source, FHitReactTrigger& Target)
+	{
+		DequantizeTriggerInput(Source.Input, Target);
+		Dequantize(Source.Impulse, Target.Impulse);
+	}
+
+	static void Quantize(const FHitReactTrigger_Linear& Source, TQuantizedTrigger<FQuantizedImpulse>& Target)
+	{
+		QuantizeTriggerInput(Source, Target.Input);
+		Quantize(Source.LinearImpulse, Target.Impulse);
+	}
+
+	static void Dequantize(const TQuantizedTrigger<FQuantizedImpulse>& Source, FHitReactTrigger_Linear& Target)
+	{
+		DequantizeTriggerInput(Source.Input, Target);
+		Dequantize(Source.Impulse, Target.LinearImpulse);
+	}
+
+	static void Quantize(const FHitReactTrigger_Angular& Source, TQuantizedTrigger<FQuantizedImpulse_Angular>& Target)
+	{
+		QuantizeTriggerInput(Source, Target.Input);
+		Quantize(Source.AngularImpulse, Target.Impulse);
+	}
+
+	static void Dequantize(const TQuantizedTrigger<FQuantizedImpulse_Angular>& Source, FHitReactTrigger_Angular& Target)
+	{
+		DequantizeTriggerInput(Source.Input, Target);
+		Dequantize(Source.Impulse, Target.AngularImpulse);
+	}
+
+	static void Quantize(const FHitReactTrigger_Radial& Source, TQuantizedTrigger<FQuantizedImpulse_Radial>& Target)
+	{
+		QuantizeTriggerInput(Source, Target.Input);
+		Quantize(Source.RadialImpulse, Target.Impulse);
+	}
+
+	static void Dequantize(const TQuantizedTrigger<FQuantizedImpulse_Radial>& Source, FHitReactTrigger_Radial& Target)
+	{
+		DequantizeTriggerInput(Source.Input, Target);
+		Dequantize(Source.Impulse, Target.RadialImpulse);
+	}
+
+	/*
+	 * Serialize / Deserialize quantized state
+	 */
+
+	static bool IsApplied(const FQuantizedImpulse& Value) { return (Value.Flags & Flag_Apply) != 0; }
+	static bool IsApplied(const FQuantizedImpulse_Angular& Value) { return IsApplied(Value.Base); }
+	static bool IsApplied(const FQuantizedImpulse_Radial& Value) { return IsApplied(Value.Base); }
+	static bool IsApplied(const FQuantizedImpulseParams& Value)
+	{
+		return IsApplied(Value.Linear) || IsApplied(Value.Angular) || IsApplied(Value.Radial);
+	}
+
+	static void Write(FNetBitStreamWriter* Writer, const FQuantizedImpulse& Value)
+	{
+		Writer->WriteBool(IsApplied(Value));
+		if (IsApplied(Value))
+		{
+			Writer->WriteBool((Value.Flags & Flag_FactorMass) != 0);
+			WriteFloat(Writer, Value.Impulse);
+		}
+	}
+
+	static void Read(FNetSerializationContext& Context, FQuantizedImpulse& Value)
+	{
+		FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+		if (Reader->ReadBool())
+		{
+			Value.Flags = Flag_Apply | (Reader->ReadBool() ? Flag_FactorMass : 0);
+			Value.Impulse = ReadFloat(Reader);
+		}
+	}
+
+	static void Write(FNetBitStreamWriter* Writer, const FQuantizedImpulse_Angular& Value)
+	{
+		Write(Writer, Value.Base);
+		if (IsApplied(Value))
+		{
+			Writer->WriteBool((Value.Base.Flags & Flag_Radians) != 0);
+		}
+	}
+
+	static void Read(FNetSerializationContext& Context, FQuantizedImpulse_Angular& Value)
+	{
+		Read(Context, Value.Base);
+		if (IsApplied(Value))
+		{
+			Value.Base.Flags |= Context.GetBitStreamReader()->ReadBool() ? Flag_Radians : 0;
+		}
+	}
+
+	static void Write(FNetBitStreamWriter* Writer, const FQuantizedImpulse_Radial& Value)
+	{
+		Write(Writer, Value.Base);
+		if (IsApplied(Value))
+		{
+			WriteFloat(Writer, Value.Radius);
+			Writer->WriteBool((Value.Base.Flags & Flag_Constant) != 0);
+		}
+	}
+
+	static void Read(FNetSerializationContext& Context, FQuantizedImpulse_Radial& Value)
+	{
+		Read(Context, Value.Base);
+		if (IsApplied(Value))
+		{
+			FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+			Value.Radius = ReadFloat(Reader);
+			Value.Base.Flags |= Reader->ReadBool() ? Flag_Constant : 0;
+		}
+	}
+
+	static void Write(FNetBitStreamWriter* Writer, const FQuantizedImpulseParams& Value)
+	{
+		Write(Writer, Value.Linear);
+		Write(Writer, Value.Angular);
+		Write(Writer, Value.Radial);
+	}
+
+	static void Read(FNetSerializationContext& Context, FQuantizedImpulseParams& Value)
+	{
+		Read(Context, Value.Linear);
+		Read(Context, Value.Angular);
+		Read(Context, Value.Radial);
+	}
+
+	static void Write(FNetBitStreamWriter* Writer, const FQuantizedWorldParams& Value)
+	{
+		for (int32 i = 0; i < 3; i++) { Writer->WriteBits(Value.LinearDirection[i], 16U); }
+		for (int32 i = 0; i < 3; i++) { Writer->WriteBits(Value.AngularDirection[i], 16U); }
+		for (int32 i = 0; i < 3; i++) { WriteDouble(Writer, Value.RadialLocation[i]); }
+	}
+
+	static void Read(FNetSerializationContext& Context, FQuantizedWorldParams& Value)
+	{
+		FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+		for (int32 i = 0; i < 3; i++) { Value.LinearDirection[i] = static_cast<uint16>(Reader->ReadBits(16U)); }
+		for (int32 i = 0; i < 3; i++) { Value.AngularDirection[i] = static_cast<uint16>(Reader->ReadBits(16U)); }
+		for (int32 i = 0; i < 3; i++) { Value.RadialLocation[i] = ReadDouble(Reader); }
+	}
+
+	static void Write(FNetBitStreamWriter* Writer, const FQuantizedInputParams& Value)
+	{
+		const FHitReactNetRegistry& Registry = FHitReactNetRegistry::Get();
+		WriteProfileOrTag(Writer, Value);
+		WriteAssetPath(Writer, Value.BoneData, Registry.GetBoneData());
+		WriteBoneName(Writer, Value.SimulatedBoneName);
+		WriteBoneName(Writer, Value.ImpulseBoneName);
+		Writer->WriteBool(Value.bIncludeSelf != 0);
+	}
+
+	static void Read(FNetSerializationContext& Context, FQuantizedInputParams& Value)
+	{
+		const FHitReactNetRegistry& Registry = FHitReactNetRegistry::Get();
+		ReadProfileOrTag(Context, Value);
+		Value.BoneData = ReadAssetPath(Context, Registry.GetBoneData());
+		Value.SimulatedBoneName = ReadBoneName(Context);
+		Value.ImpulseBoneName = ReadBoneName(Context);
+		Value.bIncludeSelf = Context.GetBitStreamReader()->ReadBool() ? 1 : 0;
+	}
+
+	/** Triggers only send anything if an impulse is applied, matching the legacy serializers */
+	template<typename ImpulseType>
+	static void Write(FNetBitStreamWriter* Writer, const TQuantizedTrigger<ImpulseType>& Value)
+	{
+		Writer->WriteBool(IsApplied(Value.Impulse));
+		if (IsApplied(Value.Impulse))
+		{
+			WriteProfileOrTag(Writer, Value.Input);
+			WriteBoneName(Writer, Value.Input.SimulatedBoneName);
+			Writer->WriteBool(Value.Input.bIncludeSelf != 0);
+			Write(Writer, Value.Impulse);
+		}
+	}
+
+	template<typename ImpulseType>
+	static void Read(FNetSerializationContext& Context, TQuantizedTrigger<ImpulseType>& Value)
+	{
+		if (Context.GetBitStreamReader()->ReadBool())
+		{
+			ReadProfileOrTag(Context, Value.Input);
+			Value.Input.SimulatedBoneName = ReadBoneName(Context);
+			Value.Input.bIncludeSelf = Context.GetBitStreamReader()->ReadBool() ? 1 : 0;
+			Read(Context, Value.Impulse);
+		}
+	}
+
+	/*
+	 * Validation
+	 */
+
+	static bool IsValid(const FHitReactImpulse& Value)
+	{
+		return !Value.bApplyImpulse || (FMath::IsFinite(Value.Impulse) && Value.Impulse >= 0.f);
+	}
+
+	static bool IsValid(const FHitReactImpulse_Radial& Value)
+	{
+		return IsValid(static_cast<const FHitReactImpulse&>(Value)) &&
+			(!Value.bApplyImpulse || (FMath::IsFinite(Value.Radius) && Value.Radius >= 0.f));
+	}
+
+	static bool IsValid(const FHitReactImpulseParams& Value)
+	{
+		return IsValid(Value.LinearImpulse) && IsValid(Value.AngularImpulse) && IsValid(Value.RadialImpulse);
+	}
+
+	static bool IsValid(const FHitReactImpulse_WorldParams& Value)
+	{
+		return !Value.LinearDirection.ContainsNaN() && !Value.AngularDirection.ContainsNaN() && !Value.RadialLocation.ContainsNaN();
+	}
+
+	static bool IsValid(const FHitReactInputParams& Value) { return true; }
+	static bool IsValid(const FHitReactTrigger& Value) { return IsValid(Value.Impulse); }
+	static bool IsValid(const FHitReactTrigger_Linear& Value) { return IsValid(Value.LinearImpulse); }
+	static bool IsValid(const FHitReactTrigger_Angular& Value) { return IsValid(Value.AngularImpulse); }
+	static bool IsValid(const FHitReactTrigger_Radial& Value) { return IsValid(Value.RadialImpulse); }
+
+	/**
+	 * Shared implementation, each serializer differs only by source and quantized type
+	 * Quantized state is zeroed before it is written so that it can be compared with Memcmp
+	 */
+	template<typename InSourceType, typename InQuantizedType>
+	struct THitReactNetSerializer
+	{
+		typedef InSourceType SourceType;
+		typedef InQuantizedType QuantizedType;
+		typedef FNetSerializerConfig ConfigType;
+
+		static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+		{
+			const QuantizedType& Value = *reinterpret_cast<const QuantizedType*>(Args.Source);
+			Write(Context.GetBitStreamWriter(), Value);
+		}
+
+		static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+		{
+			QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+			FMemory::Memzero(Target);
+			Read(Context, Target);
+		}
+
+		static void SerializeDelta(FNetSerializationContext& Context, const FNetSerializeDeltaArgs& Args)
+		{
+			const QuantizedType& Value = *reinterpret_cast<const QuantizedType*>(Args.Source);
+			const QuantizedType& Prev = *reinterpret_cast<const QuantizedType*>(Args.Prev);
+
+			// Unchanged state costs a single bit
+			const bool bUnchanged = IsEqualQuantized(Value, Prev);
+			Context.GetBitStreamWriter()->WriteBool(bUnchanged);
+			if (!bUnchanged)
+			{
+				Write(Context.GetBitStreamWriter(), Value);
+			}
+		}
+
+		static void DeserializeDelta(FNetSerializationContext& Context, const FNetDeserializeDeltaArgs& Args)
+		{
+			QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+			const QuantizedType& Prev = *reinterpret_cast<const QuantizedType*>(Args.Prev);
+			if (Context.GetBitStreamReader()->ReadBool())
+			{
+				Target = Prev;
+			}
+			else
+			{
+				FMemory::Memzero(Target);
+				Read(Context, Target);
+			}
+		}
+
+		static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+		{
+			const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+			QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+			FMemory::Memzero(Target);
+			HitReactNetSerializer::Quantize(Source, Target);
+		}
+
+		static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+		{
+			const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+			SourceType& Target = *reinterpret_cast<SourceType*>(Args.Target);
+			HitReactNetSerializer::Dequantize(Source, Target);
+		}
+
+		static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+		{
+			if (Args.bStateIsQuantized)
+			{
+				return IsEqualQuantized(*reinterpret_cast<const QuantizedType*>(Args.Source0),
+					*reinterpret_cast<const QuantizedType*>(Args.Source1));
+			}
+
+			// Compare what would actually be sent
+			QuantizedType Value0;
+			QuantizedType Value1;
+			FMemory::Memzero(Value0);
+			FMemory::Memzero(Value1);
+			HitReactNetSerializer::Quantize(*reinterpret_cast<const SourceType*>(Args.Source0), Value0);
+			HitReactNetSerializer::Quantize(*reinterpret_cast<const SourceType*>(Args.Source1), Value1);
+			return IsEqualQuantized(Value0, Value1);
+		}
+
+		static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+		{
+			return IsValid(*reinterpret_cast<const SourceType*>(Args.Source));
+		}
+
+	private:
+		static bool IsEqualQuantized(const QuantizedType& Value0, const QuantizedType& Value1)
+		{
+			return FMemory::Memcmp(&Value0, &Value1, sizeof(QuantizedType)) == 0;
+		}
+	};
+}
+
+namespace UE::Net
+{
+	using namespace HitReactNetSerializer;
+
+	struct FHitReactImpulseNetSerializer : public THitReactNetSerializer<FHitReactImpulse, FQuantizedImpulse>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactImpulseNetSerializer::ConfigType FHitReactImpulseNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulseNetSerializer);
+
+	struct FHitReactImpulse_LinearNetSerializer : public THitReactNetSerializer<FHitReactImpulse_Linear, FQuantizedImpulse>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactImpulse_LinearNetSerializer::ConfigType FHitReactImpulse_LinearNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulse_LinearNetSerializer);
+
+	struct FHitReactImpulse_AngularNetSerializer : public THitReactNetSerializer<FHitReactImpulse_Angular, FQuantizedImpulse_Angular>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactImpulse_AngularNetSerializer::ConfigType FHitReactImpulse_AngularNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulse_AngularNetSerializer);
+
+	struct FHitReactImpulse_RadialNetSerializer : public THitReactNetSerializer<FHitReactImpulse_Radial, FQuantizedImpulse_Radial>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactImpulse_RadialNetSerializer::ConfigType FHitReactImpulse_RadialNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulse_RadialNetSerializer);
+
+	struct FHitReactImpulseParamsNetSerializer : public THitReactNetSerializer<FHitReactImpulseParams, FQuantizedImpulseParams>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactImpulseParamsNetSerializer::ConfigType FHitReactImpulseParamsNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulseParamsNetSerializer);
+
+	struct FHitReactImpulse_WorldParamsNetSerializer : public THitReactNetSerializer<FHitReactImpulse_WorldParams, FQuantizedWorldParams>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactImpulse_WorldParamsNetSerializer::ConfigType FHitReactImpulse_WorldParamsNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulse_WorldParamsNetSerializer);
+
+	struct FHitReactInputParamsNetSerializer : public THitReactNetSerializer<FHitReactInputParams, FQuantizedInputParams>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactInputParamsNetSerializer::ConfigType FHitReactInputParamsNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactInputParamsNetSerializer);
+
+	struct FHitReactTriggerNetSerializer : public THitReactNetSerializer<FHitReactTrigger, TQuantizedTrigger<FQuantizedImpulseParams>>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactTriggerNetSerializer::ConfigType FHitReactTriggerNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactTriggerNetSerializer);
+
+	struct FHitReactTrigger_LinearNetSerializer : public THitReactNetSerializer<FHitReactTrigger_Linear, TQuantizedTrigger<FQuantizedImpulse>>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactTrigger_LinearNetSerializer::ConfigType FHitReactTrigger_LinearNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactTrigger_LinearNetSerializer);
+
+	struct FHitReactTrigger_AngularNetSerializer : public THitReactNetSerializer<FHitReactTrigger_Angular, TQuantizedTrigger<FQuantizedImpulse_Angular>>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactTrigger_AngularNetSerializer::ConfigType FHitReactTrigger_AngularNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactTrigger_AngularNetSerializer);
+
+	struct FHitReactTrigger_RadialNetSerializer : public THitReactNetSerializer<FHitReactTrigger_Radial, TQuantizedTrigger<FQuantizedImpulse_Radial>>
+	{
+		static constexpr uint32 Version = 0;
+		static const ConfigType DefaultConfig;
+	};
+	const FHitReactTrigger_RadialNetSerializer::ConfigType FHitReactTrigger_RadialNetSerializer::DefaultConfig;
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactTrigger_RadialNetSerializer);
+
+	/*
+	 * Register the serializers for their structs, so that Iris uses them instead of the legacy NetSerialize
+	 */
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulse("HitReactImpulse");
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulse_Linear("HitReactImpulse_Linear");
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulse_Angular("HitReactImpulse_Angular");
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulse_Radial("HitReactImpulse_Radial");
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulseParams("HitReactImpulseParams");
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulse_WorldParams("HitReactImpulse_WorldParams");
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactInputParams("HitReactInputParams");
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactTrigger("HitReactTrigger");
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactTrigger_Linear("HitReactTrigger_Linear");
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactTrigger_Angular("HitReactTrigger_Angular");
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactTrigger_Radial("HitReactTrigger_Radial");
+
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse, FHitReactImpulseNetSerializer);
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_Linear, FHitReactImpulse_LinearNetSerializer);
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_Angular, FHitReactImpulse_AngularNetSerializer);
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_Radial, FHitReactImpulse_RadialNetSerializer);
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseParams, FHitReactImpulseParamsNetSerializer);
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_WorldParams, FHitReactImpulse_WorldParamsNetSerializer);
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactInputParams, FHitReactInputParamsNetSerializer);
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger, FHitReactTriggerNetSerializer);
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger_Linear, FHitReactTrigger_LinearNetSerializer);
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger_Angular, FHitReactTrigger_AngularNetSerializer);
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger_Radial, FHitReactTrigger_RadialNetSerializer);
+
+	class FHitReactNetSerializerRegistryDelegates final : private FNetSerializerRegistryDelegates
+	{
+	public:
+		virtual ~FHitReactNetSerializerRegistryDelegates() override;
+
+	private:
+		virtual void OnPreFreezeNetSerializerRegistry() override;
+	};
+
+	static FHitReactNetSerializerRegistryDelegates HitReactNetSerializerRegistryDelegates;
+
+	FHitReactNetSerializerRegistryDelegates::~FHitReactNetSerializerRegistryDelegates()
+	{
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse);
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_Linear);
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_Angular);
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_Radial);
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseParams);
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_WorldParams);
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactInputParams);
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger);
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger_Linear);
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger_Angular);
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger_Radial);
+	}
+
+	void FHitReactNetSerializerRegistryDelegates::OnPreFreezeNetSerializerRegistry()
+	{
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse);
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_Linear);
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_Angular);
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_Radial);
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseParams);
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse_WorldParams);
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactInputParams);
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger);
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger_Linear);
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger_Angular);
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger_Radial);
+	}
+}
+#endif
@@ -0,0 +1,30 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if UE_WITH_IRIS
+#include "Iris/Serialization/NetSerializer.h"
+
+/*
+ * Native Iris NetSerializers for the replicated hit react structs
+ * These send the same content as the legacy NetSerialize implementations, including the compact profile,
+ * bone data and bone indices from FHitReactNetRegistry, but support quantized state and delta serialization
+ * so that Iris doesn't fall back to the generic struct path
+ */
+namespace UE::Net
+{
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulseNetSerializer, PROCHITREACT_API);
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulse_LinearNetSerializer, PROCHITREACT_API);
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulse_AngularNetSerializer, PROCHITREACT_API);
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulse_RadialNetSerializer, PROCHITREACT_API);
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulseParamsNetSerializer, PROCHITREACT_API);
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulse_WorldParamsNetSerializer, PROCHITREACT_API);
+	UE_NET_DECLARE_SERIALIZER(FHitReactInputParamsNetSerializer, PROCHITREACT_API);
+	UE_NET_DECLARE_SERIALIZER(FHitReactTriggerNetSerializer, PROCHITREACT_API);
+	UE_NET_DECLARE_SERIALIZER(FHitReactTrigger_LinearNetSerializer, PROCHITREACT_API);
+	UE_NET_DECLARE_SERIALIZER(FHitReactTrigger_AngularNetSerializer, PROCHITREACT_API);
+	UE_NET_DECLARE_SERIALIZER(FHitReactTrigger_RadialNetSerializer, PROCHITREACT_API);
+}
+#endif
@@ -4,6 +4,7 @@
 #include "Params/HitReactImpulse.h"
 
 #include "HitReactProfile.h"
+#include "Engine/NetSerialization.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactImpulse)
 
@@ -16,3 +17,12 @@ FHitReactPendingImpulse::FHitReactPendingImpulse(const FHitReactImpulseParams& I
 	, Profile(InProfile)
 	, ImpulseBoneName(InImpulseBoneName)
 {}
+
+bool FHitReactImpulse_WorldParams::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	// Matches the Iris FHitReactImpulse_WorldParamsNetSerializer
+	bOutSuccess &= SerializeFixedVector<1, 16>(LinearDirection, Ar);
+	bOutSuccess &= SerializeFixedVector<1, 16>(AngularDirection, Ar);
+	RadialLocation.NetSerialize(Ar, Map, bOutSuccess);
+	return !Ar.IsError();
+}
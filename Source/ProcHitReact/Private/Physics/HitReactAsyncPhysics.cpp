@@ -0,0 +1,262 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Physics/HitReactAsyncPhysics.h"
+
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Chaos/Utilities.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
+#include "PBDRigidsSolver.h"
+#include "System/HitReactVersioning.h"
+#include "UObject/ObjectKey.h"
+
+namespace HitReactAsyncPhysics
+{
+	struct FImpulse
+	{
+		/** Only used on the game thread, to drop the command if the component's physics state is destroyed */
+		TObjectKey<UPrimitiveComponent> Component;
+		FPhysicsActorHandle Handle;
+		FVector Impulse;
+		bool bAngular;
+		bool bVelChange;
+	};
+
+	struct FRadialImpulse
+	{
+		/** Only used on the game thread, to drop the command if the component's physics state is destroyed */
+		TObjectKey<UPrimitiveComponent> Component;
+		FPhysicsActorHandle Handle;
+		FVector Origin;
+		float Radius;
+		float Strength;
+		ERadialImpulseFalloff Falloff;
+		bool bVelChange;
+	};
+
+	static Chaos::FRigidBodyHandle_Internal* GetBody(const FPhysicsActorHandle& Handle)
+	{
+		// Commands for destroyed bodies are dropped before they are sent, but the particle may not have been created yet
+		return Handle && Handle->GetHandle_LowLevel() ? Handle->GetPhysicsThreadAPI() : nullptr;
+	}
+
+	static bool CanReceiveImpulse(const Chaos::FRigidBodyHandle_Internal* Body)
+	{
+		const Chaos::EObjectStateType State = Body->ObjectState();
+		return State == Chaos::EObjectStateType::Dynamic || State == Chaos::EObjectStateType::Sleeping;
+	}
+
+	static void ApplyLinearImpulse(Chaos::FRigidBodyHandle_Internal* Body, const FVector& Impulse, bool bVelChange)
+	{
+		if (Body->ObjectState() == Chaos::EObjectStateType::Sleeping)
+		{
+			Body->SetObjectState(Chaos::EObjectStateType::Dynamic);
+		}
+
+		const Chaos::FReal InvMass = bVelChange ? 1.0 : Body->InvM();
+		Body->SetLinearImpulseVelocity(Body->LinearImpulseVelocity() + Impulse * InvMass, false);
+	}
+
+	static void ApplyAngularImpulse(Chaos::FRigidBodyHandle_Internal* Body, const FVector& Impulse, bool bVelChange)
+	{
+		if (Body->ObjectState() == Chaos::EObjectStateType::Sleeping)
+		{
+			Body->SetObjectState(Chaos::EObjectStateType::Dynamic);
+		}
+
+		if (bVelChange)
+		{
+			Body->SetAngularImpulseVelocity(Body->AngularImpulseVelocity() + Impulse, false);
+			return;
+		}
+
+#if UE_5_04_OR_LATER
+		const Chaos::FRotation3 Rotation = Body->GetR();
+#else
+		const Chaos::FRotation3 Rotation = Body->R();
+#endif
+		const Chaos::FMatrix33 WorldInvInertia = Chaos::Utilities::ComputeWorldSpaceInertia(Rotation * Body->RotationOfMass(), Body->InvI());
+		Body->SetAngularImpulseVelocity(Body->AngularImpulseVelocity() + WorldInvInertia * Impulse, false);
+	}
+}
+
+/**
+ * Commands queued by the game thread during a single frame
+ */
+struct FHitReactAsyncInput : public Chaos::FSimCallbackInput
+{
+	TArray<HitReactAsyncPhysics::FImpulse> Impulses;
+	TArray<HitReactAsyncPhysics::FRadialImpulse> RadialImpulses;
+
+	void Reset()
+	{
+		Impulses.Reset();
+		RadialImpulses.Reset();
+	}
+};
+
+struct FHitReactAsyncOutput : public Chaos::FSimCallbackOutput
+{
+	void Reset() {}
+};
+
+/**
+ * Applies queued commands on the physics thread, before the step that consumes them
+ */
+class FHitReactAsyncCallback : public Chaos::TSimCallbackObject<FHitReactAsyncInput, FHitReactAsyncOutput>
+{
+	virtual void OnPreSimulate_Internal() override;
+};
+
+void FHitReactAsyncCallback::OnPreSimulate_Internal()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactAsyncCallback::OnPreSimulate_Internal);
+
+	using namespace HitReactAsyncPhysics;
+
+	const FHitReactAsyncInput* Input = GetConsumerInput_Internal();
+	if (!Input)
+	{
+		return;
+	}
+
+	// Impulses in the order they were queued
+	// Simulate state set on the game thread is marshalled ahead of this input, so impulses land on bodies that just started simulating
+	for (const FImpulse& Impulse : Input->Impulses)
+	{
+		Chaos::FRigidBodyHandle_Internal* Body = GetBody(Impulse.Handle);
+		if (Body && CanReceiveImpulse(Body))
+		{
+			if (Impulse.bAngular)
+			{
+				ApplyAngularImpulse(Body, Impulse.Impulse, Impulse.bVelChange);
+			}
+			else
+			{
+				ApplyLinearImpulse(Body, Impulse.Impulse, Impulse.bVelChange);
+			}
+		}
+	}
+
+	// Radial impulses are resolved against the body's center of mass on the physics thread
+	for (const FRadialImpulse& Radial : Input->RadialImpulses)
+	{
+		Chaos::FRigidBodyHandle_Internal* Body = GetBody(Radial.Handle);
+		if (!Body || !CanReceiveImpulse(Body))
+		{
+			continue;
+		}
+
+#if UE_5_04_OR_LATER
+		const FVector CenterOfMass = FVector(Body->GetX() + Body->GetR() * Body->CenterOfMass());
+#else
+		const FVector CenterOfMass = FVector(Body->X() + Body->R() * Body->CenterOfMass());
+#endif
+		const FVector Delta = CenterOfMass - Radial.Origin;
+		const float Distance = static_cast<float>(Delta.Size());
+		if (Distance > Radial.Radius)
+		{
+			continue;
+		}
+
+		float Magnitude = Radial.Strength;
+		if (Radial.Falloff == RIF_Linear && Radial.Radius > 0.f)
+		{
+			Magnitude *= 1.f - (Distance / Radial.Radius);
+		}
+
+		ApplyLinearImpulse(Body, Delta.GetSafeNormal() * Magnitude, Radial.bVelChange);
+	}
+}
+
+bool FHitReactAsyncPhysics::Initialize(const UWorld* World)
+{
+	Release();
+
+	FPhysScene* PhysScene = World ? World->GetPhysicsScene() : nullptr;
+	Chaos::FPBDRigidsSolver* PhysSolver = PhysScene ? PhysScene->GetSolver() : nullptr;
+	if (!PhysSolver || !PhysSolver->IsUsingAsyncResults())
+	{
+		return false;
+	}
+
+	Solver = PhysSolver;
+	Callback = Solver->CreateAndRegisterSimCallbackObject_External<FHitReactAsyncCallback>();
+	return IsValid();
+}
+
+void FHitReactAsyncPhysics::Release()
+{
+	if (Callback && Solver)
+	{
+		Solver->UnregisterAndFreeSimCallbackObject_External(Callback);
+	}
+	Callback = nullptr;
+	Solver = nullptr;
+}
+
+void FHitReactAsyncPhysics::AddImpulse(const FBodyInstance* BI, const FVector& Impulse, bool bVelChange) const
+{
+	if (!Callback || !BI)
+	{
+		return;
+	}
+
+	if (FHitReactAsyncInput* Input = Callback->GetProducerInputData_External())
+	{
+		Input->Impulses.Add({ BI->OwnerComponent.Get(), BI->GetPhysicsActorHandle(), Impulse, false, bVelChange });
+	}
+}
+
+void FHitReactAsyncPhysics::AddAngularImpulseInRadians(const FBodyInstance* BI, const FVector& Impulse, bool bVelChange) const
+{
+	if (!Callback || !BI)
+	{
+		return;
+	}
+
+	if (FHitReactAsyncInput* Input = Callback->GetProducerInputData_External())
+	{
+		Input->Impulses.Add({ BI->OwnerComponent.Get(), BI->GetPhysicsActorHandle(), Impulse, true, bVelChange });
+	}
+}
+
+void FHitReactAsyncPhysics::AddRadialImpulse(const USkeletalMeshComponent* Mesh, const FVector& Origin, float Radius,
+	float Strength, ERadialImpulseFalloff Falloff, bool bVelChange) const
+{
+	if (!Callback || !Mesh)
+	{
+		return;
+	}
+
+	if (FHitReactAsyncInput* Input = Callback->GetProducerInputData_External())
+	{
+		for (const FBodyInstance* BI : Mesh->Bodies)
+		{
+			if (BI)
+			{
+				Input->RadialImpulses.Add({ Mesh, BI->GetPhysicsActorHandle(), Origin, Radius, Strength, Falloff, bVelChange });
+			}
+		}
+	}
+}
+
+void FHitReactAsyncPhysics::DropCommands(const UPrimitiveComponent* Component) const
+{
+	if (!Callback || !Component)
+	{
+		return;
+	}
+
+	// Only the input still being produced can be touched, anything already sent was queued before the bodies were destroyed
+	if (FHitReactAsyncInput* Input = Callback->GetProducerInputData_External())
+	{
+		const TObjectKey<UPrimitiveComponent> Key(Component);
+		Input->Impulses.RemoveAll([&Key](const HitReactAsyncPhysics::FImpulse& Impulse) { return Impulse.Component == Key; });
+		Input->RadialImpulses.RemoveAll([&Key](const HitReactAsyncPhysics::FRadialImpulse& Radial) { return Radial.Component == Key; });
+	}
+}
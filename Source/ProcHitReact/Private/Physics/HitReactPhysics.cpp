@@ -10,7 +10,7 @@
 
 
 void FHitReactPhysics::HitReact(USkeletalMeshComponent* InMesh, const TObjectPtr<const UHitReactProfile>& InProfile,
-	const FName& BoneName, const TArray<FName>& InDisabledBones, const TMap<FName, float>& InBoneWeightScalars)
+	const FName& BoneName, const TArray<FName>& InDisabledBones, const TMap<FName, float>& InBoneWeightScalars, double InStartTime)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactPhysics::HitReact);
 
@@ -21,30 +21,36 @@ void FHitReactPhysics::HitReact(USkeletalMeshComponent* InMesh, const TObjectPtr
 	Mesh = InMesh;
 	SimulatedBoneName = BoneName;
 	Profile = InProfile;
+	CompiledProfile = Profile->GetCompiledShared();
 	DisabledBones = InDisabledBones;
 	BoneWeightScalars = InBoneWeightScalars;
 
 	// Activate the physics state
-	PhysicsState.Params = Profile->BlendParams;
-	PhysicsState.Activate();
+	PhysicsState.Params = CompiledProfile->BlendParams;
+	PhysicsState.Activate(InStartTime);
 }
 
 void FHitReactPhysics::Tick(float DeltaTime)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactPhysics::Tick);
+	Evaluate(PhysicsState.GetEvaluatedTime() + DeltaTime);
+}
+
+void FHitReactPhysics::Evaluate(double InTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactPhysics::Evaluate);
 
 	// Reset blend weight request
 	RequestedBlendWeight = 0.f;
 	MaxBlendWeight = 0.f;
 
 	// Update existing physics states
-	if (!PhysicsState.IsActive() || !Profile)
+	if (!PhysicsState.IsActive() || !CompiledProfile)
 	{
 		return;
 	}
 
 	// Interpolate the physics state
-	PhysicsState.Tick(DeltaTime);
+	PhysicsState.Evaluate(InTime);
 	
 	// Determine physics blend weight
 	const float StateAlpha = PhysicsState.GetBlendStateAlpha();
@@ -64,10 +70,16 @@ void FHitReactPhysics::Tick(float DeltaTime)
 	}
 
 	// Clamp the blend weight
-	MaxBlendWeight = Profile->MaxBlendWeight;
+	MaxBlendWeight = CompiledProfile->MaxBlendWeight;
 	RequestedBlendWeight = FMath::Min<float>(BlendWeight, MaxBlendWeight);
 }
 
+void FHitReactPhysics::Evict(float FadeTime)
+{
+	bEvicted = true;
+	PhysicsState.FadeOut(FadeTime);
+}
+
 bool FHitReactPhysics::IsActive() const
 {
 	return PhysicsState.IsActive();
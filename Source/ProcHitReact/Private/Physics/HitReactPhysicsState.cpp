@@ -45,10 +45,27 @@ FString FHitReactPhysicsState::GetBlendStateString() const
 	}
 }
 
+void FHitReactPhysicsState::SetAnchor(float InElapsedTime, float InDecayTime)
+{
+	ElapsedTime = FMath::Clamp<float>(InElapsedTime, 0.f, GetTotalTime());
+	DecayTime = FMath::Max<float>(0.f, InDecayTime);
+	AnchorTime = EvaluatedTime;
+	AnchorElapsedTime = ElapsedTime;
+
+	// Decay rewinds for DecayTime then resumes, so we start that much later, less any rewind lost to the clamp at zero
+	StartTime = AnchorTime + DecayTime - FMath::Max<float>(0.f, ElapsedTime - DecayTime);
+	UpdateBlendState();
+}
+
 void FHitReactPhysicsState::Reset()
 {
 	BlendState = EHitReactBlendState::Pending;
 	ElapsedTime = 0.f;
+	DecayTime = 0.f;
+	StartTime = 0.0;
+	AnchorTime = 0.0;
+	AnchorElapsedTime = 0.f;
+	EvaluatedTime = 0.0;
 }
 
 bool FHitReactPhysicsState::CanActivate(const FHitReactPhysicsStateParams& WithParams)
@@ -62,16 +79,71 @@ bool FHitReactPhysicsState::CanActivate(const FHitReactPhysicsStateParams& WithP
 	return true;
 }
 
-void FHitReactPhysicsState::Activate()
+void FHitReactPhysicsState::Activate(double InStartTime)
 {
 	BlendState = EHitReactBlendState::BlendIn;
-	ElapsedTime = 0.f;
+	EvaluatedTime = InStartTime;
+	SetAnchor(0.f, 0.f);
 }
 
 void FHitReactPhysicsState::Finish()
 {
 	BlendState = EHitReactBlendState::Completed;
 	ElapsedTime = GetTotalTime();
+	DecayTime = 0.f;
+}
+
+void FHitReactPhysicsState::FadeOut(float FadeTime)
+{
+	if (!IsActive())
+	{
+		return;
+	}
+
+	if (FadeTime <= 0.f)
+	{
+		Finish();
+		return;
+	}
+
+	// Blend weight we're fading out from
+	float BlendWeight = 1.f;
+	switch (BlendState)
+	{
+	case EHitReactBlendState::BlendIn:
+		BlendWeight = GetBlendStateAlpha();
+		break;
+	case EHitReactBlendState::BlendOut:
+		BlendWeight = 1.f - GetBlendStateAlpha();
+		break;
+	default: break;
+	}
+
+	// Skip straight to a linear blend out, starting at the same weight
+	Params.BlendIn.BlendTime = 0.f;
+	Params.BlendHoldTime = 0.f;
+	Params.BlendOut = FHitReactBlendParams(FadeTime, EAlphaBlendOption::Linear);
+	SetAnchor((1.f - BlendWeight) * FadeTime, 0.f);
+}
+
+double FHitReactPhysicsState::GetNextStateTime() const
+{
+	if (IsDecaying())
+	{
+		return AnchorTime + DecayTime;
+	}
+
+	switch (BlendState)
+	{
+	case EHitReactBlendState::BlendIn:
+		return StartTime + Params.BlendIn.BlendTime;
+	case EHitReactBlendState::BlendHold:
+		return StartTime + Params.BlendIn.BlendTime + Params.BlendHoldTime;
+	case EHitReactBlendState::BlendOut:
+		return GetCompletionTime();
+	default:
+		return EvaluatedTime;
+	}
 }
 
 float FHitReactPhysicsState::GetBlendTime() const
@@ -89,8 +161,8 @@ float FHitReactPhysicsState::GetBlendTime() const
 
 void FHitReactPhysicsState::SetElapsedTime(float InElapsedTime)
 {
-	ElapsedTime = FMath::Clamp<float>(InElapsedTime, 0.f, GetTotalTime());
-	UpdateBlendState();
+	// Any remaining decay rewinds from the new elapsed time
+	SetAnchor(InElapsedTime, GetRemainingDecayTime());
 }
 
 float FHitReactPhysicsState::GetTotalStateTime() const
@@ -171,9 +243,11 @@ const FHitReactBlendParams* FHitReactPhysicsState::GetBlendParams() const
 	}
 }
 
-bool FHitReactPhysicsState::Tick(float DeltaTime)
+bool FHitReactPhysicsState::Evaluate(double InTime)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactPhysicsState::Tick);
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactPhysicsState::Evaluate);
+
+	EvaluatedTime = InTime;
 	
 	// Nothing to do if we're completed
 	if (HasCompleted())
@@ -181,42 +255,26 @@ bool FHitReactPhysicsState::Tick(float DeltaTime)
 		return true;
 	}
 
-	// Process the decay state
+	// Process the decay state, rewinding from the anchor until it completes
 	if (IsDecaying())
 	{
-		const float PrevDecayTime = DecayTime;
-
-		// We want to retain the remaining delta time after decay is clamped, otherwise we'll lose time
-		const float TargetDecayTime = DecayTime - DeltaTime;
-
-		// Clamp the decay time
-		DecayTime = FMath::Clamp<float>(TargetDecayTime, 0.f, Params.MaxAccumulatedDecayTime);
-
-		// Calculate the remaining delta time after decay
-		DeltaTime = FMath::Max<float>(0.f, TargetDecayTime - DecayTime);
-
-		// Update the elapsed time to account for the decay
-		const float DecayDelta = PrevDecayTime - DecayTime;
-		SetElapsedTime(ElapsedTime - DecayDelta);
-
-		if (!IsDecaying())
-		{
-			// ReSharper disable once CppExpressionWithoutSideEffects
-			OnDecayComplete.ExecuteIfBound();
-		}
-
-		// DeltaTime is now the remaining time after decay, but may be zero
-		if (DeltaTime < 1e-6f)
+		const double DecayElapsedTime = InTime - AnchorTime;
+		if (DecayElapsedTime < DecayTime)
 		{
+			ElapsedTime = FMath::Max<float>(0.f, AnchorElapsedTime - DecayElapsedTime);
+			UpdateBlendState();
 			return HasCompleted();
 		}
+
+		DecayTime = 0.f;
+
+		// ReSharper disable once CppExpressionWithoutSideEffects
+		OnDecayComplete.ExecuteIfBound();
 	}
 
 	// Process the blend states
-	if (!IsDecaying())
-	{
-		SetElapsedTime(ElapsedTime + DeltaTime);
-	}
+	ElapsedTime = FMath::Clamp<float>(InTime - StartTime, 0.f, GetTotalTime());
+	UpdateBlendState();
 
 	// Notify if we've completed
 	return HasCompleted();
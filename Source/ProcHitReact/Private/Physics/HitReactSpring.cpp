@@ -0,0 +1,95 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Physics/HitReactSpring.h"
+
+#include "HitReactProfile.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactSpring)
+
+
+void FHitReactSpring::HitReact(const TObjectPtr<const UHitReactProfile>& InProfile, const FName& BoneName,
+	const FVector& InAngularVelocity)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactSpring::HitReact);
+
+	// Reset states
+	PhysicsState = {};
+	Offset = FVector::ZeroVector;
+	BlendWeight = 0.f;
+
+	// Assign properties
+	Profile = InProfile;
+	CompiledProfile = Profile->GetCompiledShared();
+	SimulatedBoneName = BoneName;
+	AngularVelocity = InAngularVelocity;
+
+	// Activate the blend envelope
+	PhysicsState.Params = CompiledProfile->BlendParams;
+	PhysicsState.Activate();
+}
+
+void FHitReactSpring::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactSpring::Tick);
+
+	BlendWeight = 0.f;
+
+	if (!PhysicsState.IsActive() || !CompiledProfile)
+	{
+		return;
+	}
+
+	// Interpolate the blend envelope
+	PhysicsState.Tick(DeltaTime);
+
+	const float StateAlpha = PhysicsState.GetBlendStateAlpha();
+	switch (PhysicsState.GetBlendState())
+	{
+	case EHitReactBlendState::BlendIn:
+		BlendWeight = StateAlpha;
+		break;
+	case EHitReactBlendState::BlendHold:
+		BlendWeight = 1.f;
+		break;
+	case EHitReactBlendState::BlendOut:
+		BlendWeight = 1.f - StateAlpha;
+		break;
+	default: break;
+	}
+
+	// Integrate the damped spring, sub-stepping to remain stable at low frame rates
+	const FHitReactSpringParams& Params = CompiledProfile->Spring;
+	const float Damping = 2.f * Params.DampingRatio * FMath::Sqrt(Params.Stiffness);
+	static constexpr float MaxStepTime = 1.f / 60.f;
+	float RemainingTime = DeltaTime;
+	while (RemainingTime > UE_KINDA_SMALL_NUMBER)
+	{
+		const float StepTime = FMath::Min(RemainingTime, MaxStepTime);
+		AngularVelocity += (-Params.Stiffness * Offset - Damping * AngularVelocity) * StepTime;
+		Offset += AngularVelocity * StepTime;
+		RemainingTime -= StepTime;
+	}
+}
+
+FQuat FHitReactSpring::GetRotation() const
+{
+	if (!CompiledProfile || BlendWeight <= 0.f)
+	{
+		return FQuat::Identity;
+	}
+
+	const float Angle = Offset.Size();
+	if (Angle <= UE_KINDA_SMALL_NUMBER)
+	{
+		return FQuat::Identity;
+	}
+
+	const float ClampedAngle = FMath::Min(Angle, FMath::DegreesToRadians(CompiledProfile->Spring.MaxAngle));
+	return FQuat(Offset / Angle, ClampedAngle * BlendWeight);
+}
+
+bool FHitReactSpring::HasCompleted() const
+{
+	return PhysicsState.HasCompleted();
+}
@@ -0,0 +1,237 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactBodyLookup.h"
+
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
+
+namespace HitReactBodyLookup
+{
+	/** Approximate a box by a capsule along its longest axis */
+	static void AddBox(const FTransform& ElemTransform, const FVector& Extents, TArray<FVector>& OutA, TArray<FVector>& OutB, TArray<float>& OutRadius)
+	{
+		int32 LongAxis = 0;
+		for (int32 Axis = 1; Axis < 3; Axis++)
+		{
+			if (Extents[Axis] > Extents[LongAxis])
+			{
+				LongAxis = Axis;
+			}
+		}
+
+		// The middle extent covers the cross-section better than the shortest, which would leave the corners out
+		const float MidExtent = Extents.X + Extents.Y + Extents.Z - Extents.GetMax() - Extents.GetMin();
+		const float Radius = 0.5f * MidExtent;
+		FVector HalfSegment = FVector::ZeroVector;
+		HalfSegment[LongAxis] = FMath::Max(0.f, 0.5f * Extents[LongAxis] - Radius);
+
+		OutA.Add(ElemTransform.TransformPosition(-HalfSegment));
+		OutB.Add(ElemTransform.TransformPosition(HalfSegment));
+		OutRadius.Add(Radius);
+	}
+}
+
+void FHitReactBodyLookup::Build(const USkeletalMeshComponent* InMesh, const TArray<FName>& ExcludedBones)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactBodyLookup::Build);
+
+	Reset();
+
+	const UPhysicsAsset* Asset = InMesh ? InMesh->GetPhysicsAsset() : nullptr;
+	if (!Asset)
+	{
+		return;
+	}
+
+	Mesh = InMesh;
+	PhysicsAsset = Asset;
+
+	TArray<FVector> A;
+	TArray<FVector> B;
+	TArray<float> Radius;
+	for (const USkeletalBodySetup* BodySetup : Asset->SkeletalBodySetups)
+	{
+		if (!BodySetup || ExcludedBones.Contains(BodySetup->BoneName))
+		{
+			continue;
+		}
+
+		const int32 BoneIndex = InMesh->GetBoneIndex(BodySetup->BoneName);
+		if (BoneIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		A.Reset();
+		B.Reset();
+		Radius.Reset();
+
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+		for (const FKSphereElem& Sphere : AggGeom.SphereElems)
+		{
+			A.Add(Sphere.Center);
+			B.Add(Sphere.Center);
+			Radius.Add(Sphere.Radius);
+		}
+		for (const FKSphylElem& Sphyl : AggGeom.SphylElems)
+		{
+			const FVector HalfSegment = Sphyl.Rotation.RotateVector(FVector(0.f, 0.f, 0.5f * Sphyl.Length));
+			A.Add(Sphyl.Center - HalfSegment);
+			B.Add(Sphyl.Center + HalfSegment);
+			Radius.Add(Sphyl.Radius);
+		}
+		for (const FKTaperedCapsuleElem& Capsule : AggGeom.TaperedCapsuleElems)
+		{
+			const FVector HalfSegment = Capsule.Rotation.RotateVector(FVector(0.f, 0.f, 0.5f * Capsule.Length));
+			A.Add(Capsule.Center - HalfSegment);
+			B.Add(Capsule.Center + HalfSegment);
+			Radius.Add(FMath::Max(Capsule.Radius0, Capsule.Radius1));
+		}
+		for (const FKBoxElem& Box : AggGeom.BoxElems)
+		{
+			HitReactBodyLookup::AddBox(FTransform(Box.Rotation, Box.Center), FVector(Box.X, Box.Y, Box.Z), A, B, Radius);
+		}
+		for (const FKConvexElem& Convex : AggGeom.ConvexElems)
+		{
+			const FTransform ConvexTransform = FTransform(Convex.ElemBox.GetCenter()) * Convex.GetTransform();
+			HitReactBodyLookup::AddBox(ConvexTransform, Convex.ElemBox.GetSize(), A, B, Radius);
+		}
+
+		if (A.Num() == 0)
+		{
+			continue;
+		}
+
+		BoneNames.Add(BodySetup->BoneName);
+		BoneIndices.Add(BoneIndex);
+		ShapeOffsets.Add(LocalShapes.Num());
+		for (int32 i = 0; i < A.Num(); i++)
+		{
+			LocalShapes.Add({ A[i], B[i], Radius[i] });
+		}
+	}
+	ShapeOffsets.Add(LocalShapes.Num());
+
+	WorldBounds.SetNumZeroed(BoneNames.Num());
+	WorldShapes.SetNumZeroed(LocalShapes.Num());
+}
+
+void FHitReactBodyLookup::Reset()
+{
+	Mesh.Reset();
+	PhysicsAsset.Reset();
+	BoneNames.Reset();
+	BoneIndices.Reset();
+	WorldBounds.Reset();
+	ShapeOffsets.Reset();
+	LocalShapes.Reset();
+	WorldShapes.Reset();
+	RefreshedFrame = MAX_uint64;
+}
+
+bool FHitReactBodyLookup::IsBuiltFor(const USkeletalMeshComponent* InMesh) const
+{
+	return InMesh && Mesh.Get() == InMesh && PhysicsAsset.Get() == InMesh->GetPhysicsAsset();
+}
+
+void FHitReactBodyLookup::Refresh()
+{
+	if (RefreshedFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactBodyLookup::Refresh);
+
+	RefreshedFrame = GFrameCounter;
+
+	const USkeletalMeshComponent* SkelMesh = Mesh.Get();
+	if (!SkelMesh)
+	{
+		return;
+	}
+
+	for (int32 Body = 0; Body < BoneNames.Num(); Body++)
+	{
+		const FTransform BoneTransform = SkelMesh->GetBoneTransform(BoneIndices[Body]);
+		const float Scale = BoneTransform.GetScale3D().GetAbsMax();
+
+		// Transform the shapes and bound them
+		FBox Box(ForceInit);
+		float MaxRadius = 0.f;
+		for (int32 Shape = ShapeOffsets[Body]; Shape < ShapeOffsets[Body + 1]; Shape++)
+		{
+			const FShape& Local = LocalShapes[Shape];
+			FShape& World = WorldShapes[Shape];
+			World.A = BoneTransform.TransformPosition(Local.A);
+			World.B = BoneTransform.TransformPosition(Local.B);
+			World.Radius = Local.Radius * Scale;
+			Box += World.A;
+			Box += World.B;
+			MaxRadius = FMath::Max(MaxRadius, World.Radius);
+		}
+
+		const FVector Center = Box.GetCenter();
+		float BoundsRadius = 0.f;
+		for (int32 Shape = ShapeOffsets[Body]; Shape < ShapeOffsets[Body + 1]; Shape++)
+		{
+			const FShape& World = WorldShapes[Shape];
+			BoundsRadius = FMath::Max(BoundsRadius, World.Radius + FMath::Sqrt(FMath::Max(FVector::DistSquared(Center, World.A), FVector::DistSquared(Center, World.B))));
+		}
+		WorldBounds[Body] = FSphere(Center, FMath::Max(BoundsRadius, MaxRadius));
+	}
+}
+
+int32 FHitReactBodyLookup::FindNearestIndex(const FVector& WorldLocation) const
+{
+	// Signed distance, so the body we're deepest inside wins if inside several
+	int32 NearestBody = INDEX_NONE;
+	float NearestDistance = TNumericLimits<float>::Max();
+	for (int32 Body = 0; Body < BoneNames.Num(); Body++)
+	{
+		// The distance to the bounds can't exceed the distance to any shape within them
+		const FSphere& Bounds = WorldBounds[Body];
+		if (FVector::Dist(WorldLocation, Bounds.Center) - Bounds.W >= NearestDistance)
+		{
+			continue;
+		}
+
+		for (int32 Shape = ShapeOffsets[Body]; Shape < ShapeOffsets[Body + 1]; Shape++)
+		{
+			const FShape& World = WorldShapes[Shape];
+			const float Distance = FMath::PointDistToSegment(WorldLocation, World.A, World.B) - World.Radius;
+			if (Distance < NearestDistance)
+			{
+				NearestDistance = Distance;
+				NearestBody = Body;
+			}
+		}
+	}
+	return NearestBody;
+}
+
+FName FHitReactBodyLookup::FindNearest(const FVector& WorldLocation)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactBodyLookup::FindNearest);
+
+	Refresh();
+
+	const int32 Body = FindNearestIndex(WorldLocation);
+	return Body != INDEX_NONE ? BoneNames[Body] : NAME_None;
+}
+
+void FHitReactBodyLookup::FindNearest(TConstArrayView<FVector> WorldLocations, TArray<FName>& OutBoneNames)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactBodyLookup::FindNearestBatch);
+
+	Refresh();
+
+	OutBoneNames.Reset(WorldLocations.Num());
+	for (const FVector& WorldLocation : WorldLocations)
+	{
+		const int32 Body = FindNearestIndex(WorldLocation);
+		OutBoneNames.Add(Body != INDEX_NONE ? BoneNames[Body] : NAME_None);
+	}
+}
@@ -0,0 +1,148 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactCompiledProfile.h"
+
+#include "HitReactProfile.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/ScopeRWLock.h"
+
+void FHitReactCompiledProfile::Compile(const UHitReactProfile* Profile)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactCompiledProfile::Compile);
+
+	BlendParams = Profile->BlendParams;
+	MaxBlendWeight = Profile->MaxBlendWeight;
+	BoneBlendRate = Profile->BoneBlendRate;
+	Cooldown = Profile->Cooldown;
+	MaxBlendHandling = Profile->MaxBlendHandling;
+	MaxActiveBlends = Profile->MaxActiveBlends;
+	Eviction = Profile->Eviction;
+	LODThreshold = Profile->LODThreshold;
+	Channel = Profile->Channel;
+	Spring = Profile->Spring;
+	PhysicalAnimProfile = Profile->PhysicalAnimProfile;
+	ConstraintProfile = Profile->ConstraintProfile;
+
+	// Sort the thresholds so the lookup can binary search, validation requires ascending order but doesn't enforce it
+	TArray<FHitReactSubsequentImpulse> SortedImpulses = Profile->SubsequentImpulseScalars;
+	SortedImpulses.StableSort([](const FHitReactSubsequentImpulse& A, const FHitReactSubsequentImpulse& B)
+	{
+		return A.ElapsedTime < B.ElapsedTime;
+	});
+	SubsequentImpulseTimes.Reset(SortedImpulses.Num());
+	SubsequentImpulseScalars.Reset(SortedImpulses.Num());
+	for (const FHitReactSubsequentImpulse& Impulse : SortedImpulses)
+	{
+		SubsequentImpulseTimes.Add(Impulse.ElapsedTime);
+		SubsequentImpulseScalars.Add(Impulse.ImpulseScalar);
+	}
+
+	BoneRemaps.Reset(Profile->RemapSimulatedBones.Num());
+	for (const TPair<FName, FName>& Remap : Profile->RemapSimulatedBones)
+	{
+		BoneRemaps.Add(Remap);
+	}
+	BoneRemaps.Sort([](const TPair<FName, FName>& A, const TPair<FName, FName>& B)
+	{
+		return A.Key.FastLess(B.Key);
+	});
+
+	BoneOverrides.Reset(Profile->BoneOverrides.Num());
+	for (const TPair<FName, FHitReactBoneOverride>& Override : Profile->BoneOverrides)
+	{
+		BoneOverrides.Add(Override);
+	}
+}
+
+float FHitReactCompiledProfile::GetSubsequentImpulseScalar(float TimeSinceLastHitReact) const
+{
+	// First threshold that hasn't been exceeded
+	const int32 Index = Algo::UpperBound(SubsequentImpulseTimes, TimeSinceLastHitReact);
+	return SubsequentImpulseScalars.IsValidIndex(Index) ? SubsequentImpulseScalars[Index] : 1.f;
+}
+
+FName FHitReactCompiledProfile::RemapSimulatedBone(const FName& BoneName) const
+{
+	const int32 Index = Algo::LowerBoundBy(BoneRemaps, BoneName, [](const TPair<FName, FName>& Remap)
+	{
+		return Remap.Key;
+	}, [](const FName& A, const FName& B)
+	{
+		return A.FastLess(B);
+	});
+	return BoneRemaps.IsValidIndex(Index) && BoneRemaps[Index].Key == BoneName ? BoneRemaps[Index].Value : BoneName;
+}
+
+FHitReactProfileTable& FHitReactProfileTable::Get()
+{
+	static FHitReactProfileTable Table;
+	return Table;
+}
+
+FHitReactProfileHandle FHitReactProfileTable::Compile(const UHitReactProfile* Profile, FHitReactProfileHandle Handle)
+{
+	check(IsInGameThread());
+
+	// Compile outside the lock, the entry is immutable once added
+	const TSharedRef<FHitReactCompiledProfile, ESPMode::ThreadSafe> Compiled = MakeShared<FHitReactCompiledProfile, ESPMode::ThreadSafe>();
+	Compiled->Compile(Profile);
+
+	FWriteScopeLock WriteLock(Lock);
+
+	// Recompile in place, the previous entry is freed once nothing holds it
+	if (FindSlot(Handle))
+	{
+		Slots[Handle.Index].Compiled = Compiled;
+		return Handle;
+	}
+
+	Handle.Index = FreeSlots.Num() > 0 ? FreeSlots.Pop() : Slots.AddDefaulted();
+	Handle.Generation = Slots[Handle.Index].Generation;
+	Slots[Handle.Index].Compiled = Compiled;
+	return Handle;
+}
+
+void FHitReactProfileTable::Release(FHitReactProfileHandle Handle)
+{
+	check(IsInGameThread());
+
+	FWriteScopeLock WriteLock(Lock);
+	if (FindSlot(Handle))
+	{
+		FSlot& Slot = Slots[Handle.Index];
+		Slot.Compiled.Reset();
+		Slot.Generation++;
+		FreeSlots.Add(Handle.Index);
+	}
+}
+
+const FHitReactProfileTable::FSlot* FHitReactProfileTable::FindSlot(FHitReactProfileHandle Handle) const
+{
+	if (Slots.IsValidIndex(Handle.Index))
+	{
+		const FSlot& Slot = Slots[Handle.Index];
+		return Slot.Generation == Handle.Generation && Slot.Compiled.IsValid() ? &Slot : nullptr;
+	}
+	return nullptr;
+}
+
+const FHitReactCompiledProfile* FHitReactProfileTable::Find(FHitReactProfileHandle Handle) const
+{
+	FReadScopeLock ReadLock(Lock);
+	const FSlot* Slot = FindSlot(Handle);
+	return Slot ? Slot->Compiled.Get() : nullptr;
+}
+
+FHitReactCompiledProfilePtr FHitReactProfileTable::FindShared(FHitReactProfileHandle Handle) const
+{
+	FReadScopeLock ReadLock(Lock);
+	const FSlot* Slot = FindSlot(Handle);
+	return Slot ? Slot->Compiled : FHitReactCompiledProfilePtr();
+}
+
+int32 FHitReactProfileTable::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Slots.Num() - FreeSlots.Num();
+}
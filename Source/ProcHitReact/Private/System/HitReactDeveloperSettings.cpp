@@ -0,0 +1,25 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactDeveloperSettings.h"
+
+#include "HitReactBoneData.h"
+#include "HitReactProfile.h"
+#include "System/HitReactNetRegistry.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactDeveloperSettings)
+
+UHitReactDeveloperSettings::UHitReactDeveloperSettings()
+{
+	CategoryName = TEXT("Plugins");
+}
+
+#if WITH_EDITOR
+void UHitReactDeveloperSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Net indices are derived from these tables
+	FHitReactNetRegistry::Get().Rebuild();
+}
+#endif
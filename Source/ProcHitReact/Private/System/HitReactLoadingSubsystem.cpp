@@ -0,0 +1,91 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactLoadingSubsystem.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactLoadingSubsystem)
+
+bool UHitReactLoadingSubsystem::AcquireAssets(const TArray<FSoftObjectPath>& Paths, FSimpleDelegate OnLoaded)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactLoadingSubsystem::AcquireAssets);
+
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+
+	// Reference each asset, only the first reference starts a load
+	TArray<TSharedPtr<FStreamableHandle>> InProgress;
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		FHitReactSharedAsset& Asset = Assets.FindOrAdd(Path);
+		if (Asset.RefCount++ == 0)
+		{
+			Asset.Handle = Streamable.RequestAsyncLoad(Path, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+		}
+		if (Asset.Handle.IsValid() && Asset.Handle->IsLoadingInProgress())
+		{
+			InProgress.Add(Asset.Handle);
+		}
+	}
+
+	// Everything is resident already
+	if (InProgress.Num() == 0)
+	{
+		return true;
+	}
+
+	// Wait on the loads, including any already in flight for other components
+	TSharedPtr<FStreamableHandle> Combined = Streamable.CreateCombinedHandle(InProgress, TEXT("HitReactSharedAssets"));
+	if (!Combined.IsValid() || !Combined->IsLoadingInProgress())
+	{
+		return true;
+	}
+
+	PendingLoads.Add(Combined);
+	Combined->BindCompleteDelegate(FStreamableDelegate::CreateWeakLambda(this,
+		[this, CombinedPtr = Combined.Get(), OnLoaded = MoveTemp(OnLoaded)]()
+	{
+		PendingLoads.RemoveAll([CombinedPtr](const TSharedPtr<FStreamableHandle>& Handle)
+		{
+			return Handle.Get() == CombinedPtr;
+		});
+		OnLoaded.ExecuteIfBound();
+	}));
+
+	return false;
+}
+
+void UHitReactLoadingSubsystem::ReleaseAssets(const TArray<FSoftObjectPath>& Paths)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactLoadingSubsystem::ReleaseAssets);
+
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		FHitReactSharedAsset* Asset = Assets.Find(Path);
+		if (Asset && --Asset->RefCount <= 0)
+		{
+			// Delayed until completion if still loading
+			if (Asset->Handle.IsValid())
+			{
+				Asset->Handle->ReleaseHandle();
+			}
+			Assets.Remove(Path);
+		}
+	}
+}
+
+void UHitReactLoadingSubsystem::Deinitialize()
+{
+	for (TPair<FSoftObjectPath, FHitReactSharedAsset>& Asset : Assets)
+	{
+		if (Asset.Value.Handle.IsValid())
+		{
+			Asset.Value.Handle->ReleaseHandle();
+		}
+	}
+	Assets.Empty();
+	PendingLoads.Empty();
+
+	Super::Deinitialize();
+}
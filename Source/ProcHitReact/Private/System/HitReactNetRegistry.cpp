@@ -0,0 +1,192 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactNetRegistry.h"
+
+#include "GameplayTagsManager.h"
+#include "HitReactBoneData.h"
+#include "HitReactProfile.h"
+#include "System/HitReactDeveloperSettings.h"
+
+namespace HitReactNetRegistry
+{
+	template<typename KeyType>
+	static void BuildTable(THitReactNetTable<KeyType>& Table, TArray<KeyType>&& Keys,
+		const TFunctionRef<bool(const KeyType&, const KeyType&)>& Less)
+	{
+		Table.Reset();
+
+		// Sort deterministically by string, never by pointer or load order
+		Keys.Sort([&Less](const KeyType& A, const KeyType& B) { return Less(A, B); });
+
+		for (KeyType& Key : Keys)
+		{
+			if (!Table.Lookup.Contains(Key))
+			{
+				Table.Entries.Add(Key);
+				Table.Lookup.Add(Key, static_cast<uint32>(Table.Entries.Num()));  // Index 0 is reserved for null
+			}
+		}
+	}
+
+	template<typename T>
+	static TArray<FSoftObjectPath> GatherPaths(const TArray<TSoftObjectPtr<T>>& Objects)
+	{
+		TArray<FSoftObjectPath> Paths;
+		Paths.Reserve(Objects.Num());
+		for (const TSoftObjectPtr<T>& Object : Objects)
+		{
+			if (!Object.IsNull())
+			{
+				Paths.Add(Object.ToSoftObjectPath());
+			}
+		}
+		return Paths;
+	}
+
+	static bool PathLess(const FSoftObjectPath& A, const FSoftObjectPath& B)
+	{
+		return A.ToString() < B.ToString();
+	}
+
+	static bool NameLess(const FName& A, const FName& B)
+	{
+		return A.LexicalLess(B);
+	}
+}
+
+FHitReactNetRegistry& FHitReactNetRegistry::Get()
+{
+	static FHitReactNetRegistry Registry;
+	return Registry;
+}
+
+void FHitReactNetRegistry::Rebuild()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactNetRegistry::Rebuild);
+
+	const UHitReactDeveloperSettings* Settings = GetDefault<UHitReactDeveloperSettings>();
+
+	HitReactNetRegistry::BuildTable<FSoftObjectPath>(Profiles, HitReactNetRegistry::GatherPaths(Settings->NetProfiles),
+		HitReactNetRegistry::PathLess);
+
+	HitReactNetRegistry::BuildTable<FSoftObjectPath>(BoneData, HitReactNetRegistry::GatherPaths(Settings->NetBoneData),
+		HitReactNetRegistry::PathLess);
+
+	TArray<FName> Names = Settings->NetBoneNames.FilterByPredicate([](const FName& Name) { return !Name.IsNone(); });
+	HitReactNetRegistry::BuildTable<FName>(BoneNames, MoveTemp(Names), HitReactNetRegistry::NameLess);
+}
+
+void FHitReactNetRegistry::NetSerializeBoneName(FArchive& Ar, FName& BoneName)
+{
+	const THitReactNetTable<FName>& Table = Get().BoneNames;
+
+	uint8 bIndexed = 0;
+	uint32 NetIndex = 0;
+	if (Ar.IsSaving())
+	{
+		if (BoneName.IsNone())
+		{
+			bIndexed = 1;
+		}
+		else
+		{
+			const int32 Found = Table.Find(BoneName);
+			bIndexed = Found != INDEX_NONE ? 1 : 0;
+			NetIndex = bIndexed ? static_cast<uint32>(Found) : 0;
+		}
+	}
+
+	Ar.SerializeBits(&bIndexed, 1);
+	if (!bIndexed)
+	{
+		// Not registered, send the name
+		Ar << BoneName;
+		return;
+	}
+
+	Ar.SerializeIntPacked(NetIndex);
+	if (Ar.IsLoading())
+	{
+		if (NetIndex == 0)
+		{
+			BoneName = NAME_None;
+		}
+		else if (Table.IsValidIndex(NetIndex))
+		{
+			BoneName = Table.Entries[NetIndex - 1];
+		}
+		else
+		{
+			// Tables differ between machines
+			BoneName = NAME_None;
+			Ar.SetError();
+		}
+	}
+}
+
+int32 FHitReactNetRegistry::GetTagNetIndex(const FGameplayTag& Tag)
+{
+	// Tag net indices come from the tag tree, so they are identical on the server and all clients
+	const FGameplayTagNetIndex NetIndex = Tag.IsValid() ? UGameplayTagsManager::Get().GetNetIndexFromTag(Tag) : INVALID_TAGNETINDEX;
+	return NetIndex != INVALID_TAGNETINDEX ? static_cast<int32>(NetIndex) : INDEX_NONE;
+}
+
+FGameplayTag FHitReactNetRegistry::GetTagFromNetIndex(uint32 NetIndex)
+{
+	const UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+	if (NetIndex >= static_cast<uint32>(Manager.GetNetworkGameplayTagNodeIndex().Num()))
+	{
+		return FGameplayTag();
+	}
+	return FGameplayTag::RequestGameplayTag(Manager.GetTagNameFromNetIndex(static_cast<FGameplayTagNetIndex>(NetIndex)), false);
+}
+
+bool FHitReactNetRegistry::NetSerializeProfileTag(FArchive& Ar, FGameplayTag& ProfileTag)
+{
+	uint8 bHasTag = 0;
+	uint8 bIndexed = 0;
+	uint32 NetIndex = 0;
+	if (Ar.IsSaving() && ProfileTag.IsValid())
+	{
+		const int32 Found = GetTagNetIndex(ProfileTag);
+		bHasTag = 1;
+		bIndexed = Found != INDEX_NONE ? 1 : 0;
+		NetIndex = bIndexed ? static_cast<uint32>(Found) : 0;
+	}
+
+	Ar.SerializeBits(&bHasTag, 1);
+	if (!bHasTag)
+	{
+		if (Ar.IsLoading())
+		{
+			ProfileTag = FGameplayTag();
+		}
+		return false;
+	}
+
+	Ar.SerializeBits(&bIndexed, 1);
+	if (!bIndexed)
+	{
+		// Not networked, send the name
+		FName TagName = ProfileTag.GetTagName();
+		Ar << TagName;
+		if (Ar.IsLoading())
+		{
+			ProfileTag = FGameplayTag::RequestGameplayTag(TagName, false);
+		}
+		return true;
+	}
+
+	Ar.SerializeIntPacked(NetIndex);
+	if (Ar.IsLoading())
+	{
+		ProfileTag = GetTagFromNetIndex(NetIndex);
+		if (!ProfileTag.IsValid())
+		{
+			// Tag trees differ between machines
+			Ar.SetError();
+		}
+	}
+	return true;
+}
@@ -0,0 +1,63 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactResidencySubsystem.h"
+
+#include "HitReact.h"
+#include "System/HitReactDeveloperSettings.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactResidencySubsystem)
+
+void UHitReactResidencySubsystem::MarkResident(UHitReact* HitReact)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactResidencySubsystem::MarkResident);
+
+	// Move to the back, it is now the most recently hit
+	Residents.Remove(HitReact);
+	Residents.Add(HitReact);
+
+	EnforceCap(HitReact);
+}
+
+void UHitReactResidencySubsystem::RemoveResident(const UHitReact* HitReact)
+{
+	Residents.RemoveAll([HitReact](const TWeakObjectPtr<UHitReact>& Resident)
+	{
+		return Resident.Get() == HitReact;
+	});
+}
+
+bool UHitReactResidencySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHitReactResidencySubsystem::EnforceCap(const UHitReact* Exclude)
+{
+	const int32 MaxResidents = GetDefault<UHitReactDeveloperSettings>()->MaxResidentPhysicsMeshes;
+	if (MaxResidents <= 0 || Residents.Num() <= MaxResidents)
+	{
+		return;
+	}
+
+	Residents.RemoveAll([](const TWeakObjectPtr<UHitReact>& Resident)
+	{
+		return !Resident.IsValid();
+	});
+
+	// Evict the least recently hit first, skipping any that are still reacting
+	// If none can be evicted we remain over the cap until the next resident is marked
+	for (int32 i = 0; i < Residents.Num() && Residents.Num() > MaxResidents;)
+	{
+		UHitReact* Resident = Residents[i].Get();
+		if (Resident != Exclude && Resident->CanEvictPhysicsResidency())
+		{
+			Residents.RemoveAt(i);
+			Resident->ReleasePhysicsResidency();
+		}
+		else
+		{
+			i++;
+		}
+	}
+}
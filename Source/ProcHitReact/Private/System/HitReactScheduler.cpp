@@ -0,0 +1,66 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactScheduler.h"
+
+#include "HitReact.h"
+#include "System/HitReactDeveloperSettings.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactScheduler)
+
+bool UHitReactScheduler::ShouldUpdate(const UHitReact* HitReact, bool bEveryFrame, int32 FramesSinceUpdate)
+{
+	const UHitReactDeveloperSettings* Settings = GetDefault<UHitReactDeveloperSettings>();
+	if (!Settings->bEnableTimeSlicing)
+	{
+		return true;
+	}
+
+	// Start a new budget each frame
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		SpentMicroseconds = 0.0;
+	}
+
+	if (bEveryFrame)
+	{
+		return true;
+	}
+
+	// Never starve a component, regardless of the budget
+	const int32 WindowFrames = FMath::Max(1, Settings->TimeSliceFrames);
+	if (FramesSinceUpdate >= WindowFrames * 2)
+	{
+		return true;
+	}
+
+	// Over budget, wait for a later frame
+	if (Settings->TimeSliceBudgetMicroseconds > 0.f && SpentMicroseconds >= Settings->TimeSliceBudgetMicroseconds)
+	{
+		return false;
+	}
+
+	// Update on our turn, or as soon as possible if we missed it due to the budget
+	int32& Slot = Slots.FindOrAdd(HitReact, INDEX_NONE);
+	if (Slot == INDEX_NONE)
+	{
+		Slot = NextSlot++ % WindowFrames;
+	}
+	return (GFrameCounter + Slot) % WindowFrames == 0 || FramesSinceUpdate >= WindowFrames;
+}
+
+void UHitReactScheduler::ReportUpdateTime(double Microseconds)
+{
+	SpentMicroseconds += Microseconds;
+}
+
+void UHitReactScheduler::Unregister(const UHitReact* HitReact)
+{
+	Slots.Remove(HitReact);
+}
+
+bool UHitReactScheduler::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,466 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && UE_WITH_IRIS
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializationContext.h"
+#include "Net/HitReactNetSerializers.h"
+#include "Params/HitReactTrigger.h"
+#include "System/HitReactDeveloperSettings.h"
+#include "System/HitReactNetRegistry.h"
+#include "UObject/CoreNet.h"
+
+/*
+ * Round trips every replicated hit react struct through both the legacy NetSerialize and the Iris NetSerializer
+ * Both paths must reproduce the source, field by field, and must agree with each other
+ */
+namespace HitReactNetSerializerTests
+{
+	using namespace UE::Net;
+
+	static constexpr uint32 BufferSize = 1024;
+
+	/** Test entries, none of these need to exist on disk */
+	static FSoftObjectPath RegisteredProfile() { return FSoftObjectPath(TEXT("/Game/HitReactTests/HR_Registered.HR_Registered")); }
+	static FSoftObjectPath UnregisteredProfile() { return FSoftObjectPath(TEXT("/Game/HitReactTests/HR_Unregistered.HR_Unregistered")); }
+	static FSoftObjectPath UnregisteredBoneData() { return FSoftObjectPath(TEXT("/Game/HitReactTests/HRB_Unregistered.HRB_Unregistered")); }
+	static FName RegisteredBone() { return TEXT("spine_02"); }
+	static FName UnregisteredBone() { return TEXT("hr_test_unregistered"); }
+
+	/** Registers a single profile and bone with FHitReactNetRegistry for the lifetime of the scope */
+	struct FScopedNetRegistry
+	{
+		FScopedNetRegistry()
+		{
+			UHitReactDeveloperSettings* Settings = GetMutableDefault<UHitReactDeveloperSettings>();
+			SavedProfiles = Settings->NetProfiles;
+			SavedBoneData = Settings->NetBoneData;
+			SavedBoneNames = Settings->NetBoneNames;
+
+			Settings->NetProfiles = { TSoftObjectPtr<UHitReactProfile>(RegisteredProfile()) };
+			Settings->NetBoneData.Reset();
+			Settings->NetBoneNames = { RegisteredBone() };
+			FHitReactNetRegistry::Get().Rebuild();
+		}
+
+		~FScopedNetRegistry()
+		{
+			UHitReactDeveloperSettings* Settings = GetMutableDefault<UHitReactDeveloperSettings>();
+			Settings->NetProfiles = SavedProfiles;
+			Settings->NetBoneData = SavedBoneData;
+			Settings->NetBoneNames = SavedBoneNames;
+			FHitReactNetRegistry::Get().Rebuild();
+		}
+
+		TArray<TSoftObjectPtr<UHitReactProfile>> SavedProfiles;
+		TArray<TSoftObjectPtr<UHitReactBoneData>> SavedBoneData;
+		TArray<FName> SavedBoneNames;
+	};
+
+	/** Quantized state storage, large enough for any of our serializers */
+	struct FQuantizedBuffer
+	{
+		alignas(16) uint8 Data[256] = {};
+	};
+
+	template<typename T>
+	static bool LegacyRoundTrip(const T& Source, T& Result)
+	{
+		T Copy = Source;
+		bool bSuccess = true;
+		FNetBitWriter Writer(nullptr, BufferSize * 8);
+		Copy.NetSerialize(Writer, nullptr, bSuccess);
+
+		FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+		Result.NetSerialize(Reader, nullptr, bSuccess);
+		return bSuccess && !Writer.IsError() && !Reader.IsError() && Reader.AtEnd();
+	}
+
+	static void Quantize(const FNetSerializer& Serializer, FNetSerializationContext& Context, const void* Source,
+		FQuantizedBuffer& Target)
+	{
+		FNetQuantizeArgs Args = {};
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		Args.Source = NetSerializerValuePointer(Source);
+		Args.Target = NetSerializerValuePointer(&Target.Data);
+		Serializer.Quantize(Context, Args);
+	}
+
+	static void Dequantize(const FNetSerializer& Serializer, FNetSerializationContext& Context, const FQuantizedBuffer& Source,
+		void* Target)
+	{
+		FNetDequantizeArgs Args = {};
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		Args.Source = NetSerializerValuePointer(&Source.Data);
+		Args.Target = NetSerializerValuePointer(Target);
+		Serializer.Dequantize(Context, Args);
+	}
+
+	template<typename T>
+	static bool IrisRoundTrip(const FNetSerializer& Serializer, const T& Source, T& Result)
+	{
+		check(Serializer.QuantizedTypeSize <= sizeof(FQuantizedBuffer::Data));
+
+		uint8 Buffer[BufferSize] = {};
+		FNetBitStreamWriter Writer;
+		Writer.InitBytes(Buffer, BufferSize);
+		FNetSerializationContext WriteContext(&Writer);
+
+		FQuantizedBuffer Sent;
+		Quantize(Serializer, WriteContext, &Source, Sent);
+
+		FNetSerializeArgs SerializeArgs = {};
+		SerializeArgs.Version = Serializer.Version;
+		SerializeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		SerializeArgs.Source = NetSerializerValuePointer(&Sent.Data);
+		Serializer.Serialize(WriteContext, SerializeArgs);
+		Writer.CommitWrites();
+
+		FNetBitStreamReader Reader;
+		Reader.InitBits(Buffer, Writer.GetPosBits());
+		FNetSerializationContext ReadContext(&Reader);
+
+		FQuantizedBuffer Received;
+		FNetDeserializeArgs DeserializeArgs = {};
+		DeserializeArgs.Version = Serializer.Version;
+		DeserializeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		DeserializeArgs.Target = NetSerializerValuePointer(&Received.Data);
+		Serializer.Deserialize(ReadContext, DeserializeArgs);
+		Dequantize(Serializer, ReadContext, Received, &Result);
+
+		return !Writer.IsOverflown() && !Reader.IsOverflown() && !ReadContext.HasError() &&
+			Reader.GetPosBits() == Writer.GetPosBits();
+	}
+
+	/** Delta against Prev, returns the number of bits written */
+	template<typename T>
+	static uint32 IrisDeltaRoundTrip(const FNetSerializer& Serializer, const T& Source, const T& Prev, T& Result, bool& bOutSuccess)
+	{
+		check(Serializer.QuantizedTypeSize <= sizeof(FQuantizedBuffer::Data));
+
+		uint8 Buffer[BufferSize] = {};
+		FNetBitStreamWriter Writer;
+		Writer.InitBytes(Buffer, BufferSize);
+		FNetSerializationContext WriteContext(&Writer);
+
+		FQuantizedBuffer Sent;
+		FQuantizedBuffer SentPrev;
+		Quantize(Serializer, WriteContext, &Source, Sent);
+		Quantize(Serializer, WriteContext, &Prev, SentPrev);
+
+		FNetSerializeDeltaArgs SerializeArgs = {};
+		SerializeArgs.Version = Serializer.Version;
+		SerializeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		SerializeArgs.Source = NetSerializerValuePointer(&Sent.Data);
+		SerializeArgs.Prev = NetSerializerValuePointer(&SentPrev.Data);
+		Serializer.SerializeDelta(WriteContext, SerializeArgs);
+		Writer.CommitWrites();
+
+		FNetBitStreamReader Reader;
+		Reader.InitBits(Buffer, Writer.GetPosBits());
+		FNetSerializationContext ReadContext(&Reader);
+
+		FQuantizedBuffer Received;
+		FNetDeserializeDeltaArgs DeserializeArgs = {};
+		DeserializeArgs.Version = Serializer.Version;
+		DeserializeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		DeserializeArgs.Target = NetSerializerValuePointer(&Received.Data);
+		DeserializeArgs.Prev = NetSerializerValuePointer(&SentPrev.Data);
+		Serializer.DeserializeDelta(ReadContext, DeserializeArgs);
+		Dequantize(Serializer, ReadContext, Received, &Result);
+
+		bOutSuccess = !Writer.IsOverflown() && !Reader.IsOverflown() && !ReadContext.HasError() &&
+			Reader.GetPosBits() == Writer.GetPosBits();
+		return Writer.GetPosBits();
+	}
+
+	/*
+	 * Field comparisons, only fields that are replicated are compared
+	 */
+
+	static void TestFields(FAutomationTestBase& Test, const FString& What, const FHitReactImpulse& A, const FHitReactImpulse& B)
+	{
+		Test.TestEqual(What + TEXT(".bApplyImpulse"), A.bApplyImpulse, B.bApplyImpulse);
+		if (A.bApplyImpulse && B.bApplyImpulse)
+		{
+			Test.TestEqual(What + TEXT(".bFactorMass"), A.bFactorMass, B.bFactorMass);
+			Test.TestEqual(What + TEXT(".Impulse"), A.Impulse, B.Impulse);
+		}
+	}
+
+	static void TestFields(FAutomationTestBase& Test, const FString& What, const FHitReactImpulse_Angular& A,
+		const FHitReactImpulse_Angular& B)
+	{
+		TestFields(Test, What, static_cast<const FHitReactImpulse&>(A), static_cast<const FHitReactImpulse&>(B));
+		if (A.bApplyImpulse && B.bApplyImpulse)
+		{
+			Test.TestTrue(What + TEXT(".AngularUnits"), A.AngularUnits == B.AngularUnits);
+		}
+	}
+
+	static void TestFields(FAutomationTestBase& Test, const FString& What, const FHitReactImpulse_Radial& A,
+		const FHitReactImpulse_Radial& B)
+	{
+		TestFields(Test, What, static_cast<const FHitReactImpulse&>(A), static_cast<const FHitReactImpulse&>(B));
+		if (A.bApplyImpulse && B.bApplyImpulse)
+		{
+			Test.TestEqual(What + TEXT(".Radius"), A.Radius, B.Radius);
+			Test.TestTrue(What + TEXT(".Falloff"), A.Falloff == B.Falloff);
+		}
+	}
+
+	static void TestFields(FAutomationTestBase& Test, const FString& What, const FHitReactImpulseParams& A,
+		const FHitReactImpulseParams& B)
+	{
+		TestFields(Test, What + TEXT(".LinearImpulse"), A.LinearImpulse, B.LinearImpulse);
+		TestFields(Test, What + TEXT(".AngularImpulse"), A.AngularImpulse, B.AngularImpulse);
+		TestFields(Test, What + TEXT(".RadialImpulse"), A.RadialImpulse, B.RadialImpulse);
+	}
+
+	static void TestFields(FAutomationTestBase& Test, const FString& What, const FHitReactImpulse_WorldParams& A,
+		const FHitReactImpulse_WorldParams& B)
+	{
+		// Directions are sent as 16-bit fixed point by both paths
+		Test.TestTrue(What + TEXT(".LinearDirection"), A.LinearDirection.Equals(B.LinearDirection, UE_KINDA_SMALL_NUMBER));
+		Test.TestTrue(What + TEXT(".AngularDirection"), A.AngularDirection.Equals(B.AngularDirection, UE_KINDA_SMALL_NUMBER));
+		Test.TestTrue(What + TEXT(".RadialLocation"), A.RadialLocation.Equals(B.RadialLocation, UE_KINDA_SMALL_NUMBER));
+	}
+
+	static void TestFields(FAutomationTestBase& Test, const FString& What, const FHitReactInputParams& A,
+		const FHitReactInputParams& B)
+	{
+		Test.TestEqual(What + TEXT(".Profile"), A.Profile.ToSoftObjectPath(), B.Profile.ToSoftObjectPath());
+		Test.TestEqual(What + TEXT(".BoneData"), A.BoneData.ToSoftObjectPath(), B.BoneData.ToSoftObjectPath());
+		Test.TestEqual(What + TEXT(".SimulatedBoneName"), A.SimulatedBoneName, B.SimulatedBoneName);
+		Test.TestEqual(What + TEXT(".ImpulseBoneName"), A.ImpulseBoneName, B.ImpulseBoneName);
+		Test.TestEqual(What + TEXT(".bIncludeSelf"), A.bIncludeSelf, B.bIncludeSelf);
+	}
+
+	/** Triggers only replicate the profile, simulated bone and bIncludeSelf, and only if an impulse is applied */
+	static void TestTriggerInputFields(FAutomationTestBase& Test, const FString& What, const FHitReactInputParams& A,
+		const FHitReactInputParams& B, bool bApplied)
+	{
+		if (!bApplied)
+		{
+			return;
+		}
+		Test.TestEqual(What + TEXT(".Profile"), A.Profile.ToSoftObjectPath(), B.Profile.ToSoftObjectPath());
+		Test.TestEqual(What + TEXT(".SimulatedBoneName"), A.SimulatedBoneName, B.SimulatedBoneName);
+		Test.TestEqual(What + TEXT(".bIncludeSelf"), A.bIncludeSelf, B.bIncludeSelf);
+	}
+
+	static void TestFields(FAutomationTestBase& Test, const FString& What, const FHitReactTrigger& A, const FHitReactTrigger& B)
+	{
+		TestTriggerInputFields(Test, What, A, B, A.Impulse.LinearImpulse || A.Impulse.AngularImpulse || A.Impulse.RadialImpulse);
+		TestFields(Test, What + TEXT(".Impulse"), A.Impulse, B.Impulse);
+	}
+
+	static void TestFields(FAutomationTestBase& Test, const FString& What, const FHitReactTrigger_Linear& A,
+		const FHitReactTrigger_Linear& B)
+	{
+		TestTriggerInputFields(Test, What, A, B, A.LinearImpulse);
+		TestFields(Test, What + TEXT(".LinearImpulse"), A.LinearImpulse, B.LinearImpulse);
+	}
+
+	static void TestFields(FAutomationTestBase& Test, const FString& What, const FHitReactTrigger_Angular& A,
+		const FHitReactTrigger_Angular& B)
+	{
+		TestTriggerInputFields(Test, What, A, B, A.AngularImpulse);
+		TestFields(Test, What + TEXT(".AngularImpulse"), A.AngularImpulse, B.AngularImpulse);
+	}
+
+	static void TestFields(FAutomationTestBase& Test, const FString& What, const FHitReactTrigger_Radial& A,
+		const FHitReactTrigger_Radial& B)
+	{
+		TestTriggerInputFields(Test, What, A, B, A.RadialImpulse);
+		TestFields(Test, What + TEXT(".RadialImpulse"), A.RadialImpulse, B.RadialImpulse);
+	}
+
+	/** Both paths must reproduce the source and agree with each other */
+	template<typename T>
+	static void TestRoundTrip(FAutomationTestBase& Test, const FString& What, const FNetSerializer& Serializer, const T& Source)
+	{
+		T Legacy;
+		T Iris;
+		Test.TestTrue(What + TEXT(" legacy round trip"), LegacyRoundTrip(Source, Legacy));
+		Test.TestTrue(What + TEXT(" iris round trip"), IrisRoundTrip(Serializer, Source, Iris));
+
+		TestFields(Test, What + TEXT(" (legacy)"), Source, Legacy);
+		TestFields(Test, What + TEXT(" (iris)"), Source, Iris);
+		TestFields(Test, What + TEXT(" (iris vs legacy)"), Legacy, Iris);
+	}
+
+	/** Unchanged state must cost a single bit, changed state must reproduce the source */
+	template<typename T>
+	static void TestDelta(FAutomationTestBase& Test, const FString& What, const FNetSerializer& Serializer, const T& Source,
+		const T& Changed)
+	{
+		bool bSuccess = false;
+		T Unchanged;
+		const uint32 UnchangedBits = IrisDeltaRoundTrip(Serializer, Source, Source, Unchanged, bSuccess);
+		Test.TestTrue(What + TEXT(" unchanged delta round trip"), bSuccess);
+		Test.TestEqual(What + TEXT(" unchanged delta bits"), UnchangedBits, 1U);
+		TestFields(Test, What + TEXT(" (unchanged delta)"), Source, Unchanged);
+
+		T Result;
+		const uint32 ChangedBits = IrisDeltaRoundTrip(Serializer, Changed, Source, Result, bSuccess);
+		Test.TestTrue(What + TEXT(" changed delta round trip"), bSuccess);
+		Test.TestTrue(What + TEXT(" changed delta bits"), ChangedBits > 1U);
+		TestFields(Test, What + TEXT(" (changed delta)"), Changed, Result);
+	}
+
+	/*
+	 * Test values
+	 */
+
+	static FHitReactImpulseParams MakeImpulseParams()
+	{
+		FHitReactImpulseParams Params;
+		Params.LinearImpulse.bApplyImpulse = true;
+		Params.LinearImpulse.bFactorMass = true;
+		Params.LinearImpulse.Impulse = 812.5f;
+		Params.AngularImpulse.bApplyImpulse = true;
+		Params.AngularImpulse.Impulse = 90.25f;
+		Params.AngularImpulse.AngularUnits = EHitReactUnits::Radians;
+		Params.RadialImpulse.bApplyImpulse = true;
+		Params.RadialImpulse.Impulse = 1300.f;
+		Params.RadialImpulse.Radius = 275.5f;
+		Params.RadialImpulse.Falloff = EHitReactFalloff::Constant;
+		return Params;
+	}
+
+	template<typename T>
+	static void SetInput(T& Params, const FSoftObjectPath& Profile, const FName& SimulatedBone, const FName& ImpulseBone)
+	{
+		Params.Profile = TSoftObjectPtr<UHitReactProfile>(Profile);
+		Params.SimulatedBoneName = SimulatedBone;
+		Params.ImpulseBoneName = ImpulseBone;
+		Params.bIncludeSelf = false;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHitReactNetSerializerImpulseTest, "ProcHitReact.Net.Serializers.Impulse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FHitReactNetSerializerImpulseTest::RunTest(const FString& Parameters)
+{
+	using namespace HitReactNetSerializerTests;
+
+	const FHitReactImpulseParams Params = MakeImpulseParams();
+
+	// Not applied, nothing else is sent
+	TestRoundTrip(*this, TEXT("FHitReactImpulse (not applied)"), UE_NET_GET_SERIALIZER(FHitReactImpulseNetSerializer),
+		FHitReactImpulse());
+
+	TestRoundTrip(*this, TEXT("FHitReactImpulse"), UE_NET_GET_SERIALIZER(FHitReactImpulseNetSerializer),
+		static_cast<const FHitReactImpulse&>(Params.LinearImpulse));
+	TestRoundTrip(*this, TEXT("FHitReactImpulse_Linear"), UE_NET_GET_SERIALIZER(FHitReactImpulse_LinearNetSerializer),
+		Params.LinearImpulse);
+	TestRoundTrip(*this, TEXT("FHitReactImpulse_Angular"), UE_NET_GET_SERIALIZER(FHitReactImpulse_AngularNetSerializer),
+		Params.AngularImpulse);
+	TestRoundTrip(*this, TEXT("FHitReactImpulse_Radial"), UE_NET_GET_SERIALIZER(FHitReactImpulse_RadialNetSerializer),
+		Params.RadialImpulse);
+	TestRoundTrip(*this, TEXT("FHitReactImpulseParams"), UE_NET_GET_SERIALIZER(FHitReactImpulseParamsNetSerializer),
+		Params);
+
+	FHitReactImpulse_WorldParams WorldParams;
+	WorldParams.LinearDirection = FVector(0.6, -0.8, 0.0);
+	WorldParams.AngularDirection = FVector(0.0, 0.0, 1.0);
+	WorldParams.RadialLocation = FVector(1048576.125, -524288.5, 1024.25);  // Needs double precision
+	TestRoundTrip(*this, TEXT("FHitReactImpulse_WorldParams"),
+		UE_NET_GET_SERIALIZER(FHitReactImpulse_WorldParamsNetSerializer), WorldParams);
+
+	FHitReactImpulseParams ChangedParams = Params;
+	ChangedParams.RadialImpulse.Radius = 50.f;
+	TestDelta(*this, TEXT("FHitReactImpulseParams"), UE_NET_GET_SERIALIZER(FHitReactImpulseParamsNetSerializer),
+		Params, ChangedParams);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHitReactNetSerializerInputTest, "ProcHitReact.Net.Serializers.InputParams",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FHitReactNetSerializerInputTest::RunTest(const FString& Parameters)
+{
+	using namespace HitReactNetSerializerTests;
+
+	const FScopedNetRegistry Registry;
+	TestTrue(TEXT("Profile is registered"), FHitReactNetRegistry::Get().IsProfileRegistered(RegisteredProfile()));
+	TestFalse(TEXT("Profile is not registered"), FHitReactNetRegistry::Get().IsProfileRegistered(UnregisteredProfile()));
+
+	const FNetSerializer& Serializer = UE_NET_GET_SERIALIZER(FHitReactInputParamsNetSerializer);
+
+	// Nothing set, null indices
+	TestRoundTrip(*this, TEXT("FHitReactInputParams (empty)"), Serializer, FHitReactInputParams());
+
+	// Registered entries replicate as indices
+	FHitReactInputParams Registered;
+	SetInput(Registered, RegisteredProfile(), RegisteredBone(), NAME_None);
+	TestRoundTrip(*this, TEXT("FHitReactInputParams (registered)"), Serializer, Registered);
+
+	// Unregistered entries fall back to the full path or name
+	FHitReactInputParams Unregistered;
+	SetInput(Unregistered, UnregisteredProfile(), UnregisteredBone(), RegisteredBone());
+	Unregistered.BoneData = TSoftObjectPtr<UHitReactBoneData>(UnregisteredBoneData());
+	TestRoundTrip(*this, TEXT("FHitReactInputParams (unregistered)"), Serializer, Unregistered);
+
+	TestDelta(*this, TEXT("FHitReactInputParams"), Serializer, Registered, Unregistered);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHitReactNetSerializerTriggerTest, "ProcHitReact.Net.Serializers.Trigger",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FHitReactNetSerializerTriggerTest::RunTest(const FString& Parameters)
+{
+	using namespace HitReactNetSerializerTests;
+
+	const FScopedNetRegistry Registry;
+	const FHitReactImpulseParams Params = MakeImpulseParams();
+
+	// No impulse applied, nothing is sent at all
+	TestRoundTrip(*this, TEXT("FHitReactTrigger (not applied)"), UE_NET_GET_SERIALIZER(FHitReactTriggerNetSerializer),
+		FHitReactTrigger());
+
+	FHitReactTrigger Trigger;
+	SetInput(Trigger, RegisteredProfile(), RegisteredBone(), NAME_None);
+	Trigger.Impulse = Params;
+	TestRoundTrip(*this, TEXT("FHitReactTrigger"), UE_NET_GET_SERIALIZER(FHitReactTriggerNetSerializer), Trigger);
+
+	FHitReactTrigger UnregisteredTrigger = Trigger;
+	SetInput(UnregisteredTrigger, UnregisteredProfile(), UnregisteredBone(), NAME_None);
+	TestRoundTrip(*this, TEXT("FHitReactTrigger (unregistered)"), UE_NET_GET_SERIALIZER(FHitReactTriggerNetSerializer),
+		UnregisteredTrigger);
+
+	FHitReactTrigger_Linear Linear;
+	SetInput(Linear, UnregisteredProfile(), RegisteredBone(), NAME_None);
+	Linear.LinearImpulse = Params.LinearImpulse;
+	TestRoundTrip(*this, TEXT("FHitReactTrigger_Linear"), UE_NET_GET_SERIALIZER(FHitReactTrigger_LinearNetSerializer),
+		Linear);
+
+	FHitReactTrigger_Angular Angular;
+	SetInput(Angular, RegisteredProfile(), UnregisteredBone(), NAME_None);
+	Angular.AngularImpulse = Params.AngularImpulse;
+	TestRoundTrip(*this, TEXT("FHitReactTrigger_Angular"), UE_NET_GET_SERIALIZER(FHitReactTrigger_AngularNetSerializer),
+		Angular);
+
+	FHitReactTrigger_Radial Radial;
+	SetInput(Radial, RegisteredProfile(), RegisteredBone(), NAME_None);
+	Radial.RadialImpulse = Params.RadialImpulse;
+	TestRoundTrip(*this, TEXT("FHitReactTrigger_Radial"), UE_NET_GET_SERIALIZER(FHitReactTrigger_RadialNetSerializer),
+		Radial);
+
+	TestDelta(*this, TEXT("FHitReactTrigger"), UE_NET_GET_SERIALIZER(FHitReactTriggerNetSerializer), Trigger,
+		UnregisteredTrigger);
+
+	return true;
+}
+
+#endif
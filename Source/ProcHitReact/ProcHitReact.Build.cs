@@ -14,6 +14,8 @@ public class ProcHitReact : ModuleRules
 			{
 				"Core",
 				"GameplayTags",
+				"NetCore",
+				"AnimGraphRuntime",
 			}
 		);
 			
@@ -24,9 +26,14 @@ public class ProcHitReact : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"PhysicsCore",
+				"Chaos",
+				"DeveloperSettings",
 			}
 		);
 		
+		// Native Iris NetSerializers for the replicated hit react structs
+		SetupIrisSupport(Target);
+
 		if (Target.bBuildEditor)
 		{
 			// FNotificationInfo & FSlateNotificationManager
@@ -0,0 +1,49 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BoneControllers/AnimNode_RigidBody.h"
+#include "Params/HitReactImpulse.h"
+#include "AnimNode_HitReactRigidBody.generated.h"
+
+class UHitReact;
+
+/**
+ * Simulates hit reacts from the owner's UHitReact component locally on the animation thread
+ * Requires UHitReact::Backend to be AnimNode, the world physics scene is not touched
+ * Each simulated bone is blended with the input pose by its hit react weight
+ */
+USTRUCT(BlueprintInternalUseOnly)
+struct PROCHITREACT_API FAnimNode_HitReactRigidBody : public FAnimNode_RigidBody
+{
+	GENERATED_BODY()
+
+	FAnimNode_HitReactRigidBody()
+		: bSimulating(false)
+	{}
+
+	// FAnimNode_Base interface
+	virtual void PreUpdate(const UAnimInstance* InAnimInstance) override;
+	// End of FAnimNode_Base interface
+
+	// FAnimNode_SkeletalControlBase interface
+	virtual void EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms) override;
+	// End of FAnimNode_SkeletalControlBase interface
+
+protected:
+	/** Apply the impulses received from the component to the simulation */
+	void ApplyImpulses(const FComponentSpacePoseContext& Output);
+
+	/** Component that drives this node, game thread only */
+	TWeakObjectPtr<UHitReact> HitReact;
+
+	/** Per-bone blend weights copied from the component */
+	TMap<FName, float> BoneWeights;
+
+	/** Impulses consumed from the component, waiting to be applied */
+	TArray<FHitReactAnimImpulse> Impulses;
+
+	/** True while any bone is reacting, the simulation is reset to the input pose when this starts */
+	bool bSimulating;
+};
@@ -0,0 +1,36 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BoneControllers/AnimNode_SkeletalControlBase.h"
+#include "AnimNode_HitReactSpring.generated.h"
+
+class UHitReact;
+
+/**
+ * Applies the physics-free spring hit reacts from the owner's UHitReact component
+ * Springs are used by profiles beyond their LODThreshold, this node does nothing while none are active
+ */
+USTRUCT(BlueprintInternalUseOnly)
+struct PROCHITREACT_API FAnimNode_HitReactSpring : public FAnimNode_SkeletalControlBase
+{
+	GENERATED_BODY()
+
+	// FAnimNode_Base interface
+	virtual bool HasPreUpdate() const override { return true; }
+	virtual void PreUpdate(const UAnimInstance* InAnimInstance) override;
+	// End of FAnimNode_Base interface
+
+	// FAnimNode_SkeletalControlBase interface
+	virtual void EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms) override;
+	virtual bool IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones) override;
+	// End of FAnimNode_SkeletalControlBase interface
+
+protected:
+	/** Component that drives this node, game thread only */
+	TWeakObjectPtr<UHitReact> HitReact;
+
+	/** Component space rotation per bone copied from the component */
+	TMap<FName, FQuat> BoneRotations;
+};
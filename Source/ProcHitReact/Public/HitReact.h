@@ -5,17 +5,24 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "HitReactTypes.h"
+#include "Physics/HitReactAsyncPhysics.h"
 #include "Physics/HitReactPhysics.h"
+#include "Physics/HitReactSpring.h"
 #include "Components/ActorComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Net/HitReactEventBuffer.h"
 #include "Params/HitReactImpulse.h"
 #include "Params/HitReactParams.h"
 #include "Params/HitReactTrigger.h"
 #include "ThirdParty/AsyncMixinProc.h"
+#include "System/HitReactBodyLookup.h"
 #include "System/HitReactVersioning.h"
 #include "HitReact.generated.h"
 
 class UHitReactProfile;
 class UPhysicalAnimationComponent;
+class UPhysicsAsset;
+struct FHitReactCompiledProfile;
 
 DECLARE_DYNAMIC_DELEGATE(FOnHitReactInitialized);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHitReactToggleStateChanged, EHitReactToggleState, NewState);
@@ -38,6 +45,14 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(EditCondition="bUseFixedSimulationRate", UIMin="1", ClampMin="1", UIMax="120", Delta="1"))
 	float SimulationRate = 60.f;
 
+	/**
+	 * Maximum simulation steps per frame when using SimulationRate
+	 * Steps beyond this are dropped, so a hitch can't cause a spiral of work
+	 * Blends still advance by the dropped time, so they don't fall behind when time sliced
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AdvancedDisplay, Category=HitReact, meta=(EditCondition="bUseFixedSimulationRate", UIMin="1", ClampMin="1", UIMax="8"))
+	int32 MaxSubsteps = 4;
+
 	/** Hit react profiles available for use when applying hit reacts */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
 	TArray<TSoftObjectPtr<UHitReactProfile>> AvailableProfiles;
@@ -46,9 +61,13 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
 	TArray<TSoftObjectPtr<UHitReactBoneData>> AvailableBoneData;
 	
-	/** If true, update at the SimulationRate instead of each Tick */
+	/**
+	 * If true, step the simulation at the SimulationRate instead of each Tick
+	 * Blend weights are interpolated between the last two steps, so they remain smooth at any frame rate
+	 * The component still ticks every frame, this no longer sets its TickInterval
+	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(InlineEditConditionToggle))
-	bool bUseFixedSimulationRate = true;
+	bool bUseFixedSimulationRate = false;
 
 	/**
 	 * Hit reacts will not trigger until Cooldown has lapsed
@@ -64,7 +83,44 @@ public:
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
 	TArray<FName> BlacklistedBones = { "root", "pelvis" };
+
+	/**
+	 * Independent budgets for hit reacts by the Channel declared on their profile
+	 * Profiles without a channel, or with a channel not listed here, only use their own limits
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(ForceInlineRow, Categories="HitReact.Channel"))
+	TMap<FGameplayTag, FHitReactChannel> Channels;
+
+	/**
+	 * Maximum number of bodies simulated by all physics blends, counting the bodies below each simulated bone
+	 * Once reached, new hit reacts are handled by MaxSimulatedBodiesHandling
+	 * Set to 0 for no limit
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(UIMin="0", ClampMin="0"))
+	int32 MaxSimulatedBodies = 0;
+
+	/** How to handle new hit reacts once MaxSimulatedBodies is reached */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(EditCondition="MaxSimulatedBodies > 0"))
+	EHitReactMaxBlendHandling MaxSimulatedBodiesHandling = EHitReactMaxBlendHandling::Evict;
+
+	/** How to choose and fade out an active blend to make room once MaxSimulatedBodies is reached */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(EditCondition="MaxSimulatedBodies > 0 && MaxSimulatedBodiesHandling == EHitReactMaxBlendHandling::Evict"))
+	FHitReactEviction Eviction;
+
+	/**
+	 * How hit reacts are simulated
+	 * AnimNode requires the Hit React RigidBody node in the mesh's Anim Blueprint, and does not use constraint or physical animation profiles
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
+	EHitReactBackend Backend = EHitReactBackend::Physics;
 	
+	/**
+	 * If true, impulses are sent to the physics thread as a single batch each frame
+	 * Only takes effect when async physics is enabled for the physics scene, otherwise they are applied on the game thread
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AdvancedDisplay, Category=HitReact)
+	bool bUseAsyncPhysics = false;
+
 	/** Whether to apply hit reacts on dedicated servers */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, AdvancedDisplay, Category=HitReact)
 	bool bApplyHitReactOnDedicatedServer = false;
@@ -72,12 +128,74 @@ public:
 	/** Global interp toggle parameters for enabling and disabling the hit react system */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
 	FHitReactGlobalToggle GlobalToggle;
+
+	/** Cull hit reacts that are far away or off-screen before they modify the mesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	FHitReactCulling Culling;
+
+	/** Controls how long the mesh keeps a physics collision mode after hit reacts, to avoid recreating its physics state */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	FHitReactPhysicsResidency PhysicsResidency;
+
+	/**
+	 * If true, ReplicateHitReact writes to a replicated per-actor event buffer instead of requiring a multicast per hit
+	 * The component will be set to replicate when play begins
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="HitReact|Networking")
+	bool bReplicateHitReactEvents = false;
+
+	/** Maximum number of recent events held in the replicated buffer, the oldest is overwritten */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="HitReact|Networking", meta=(EditCondition="bReplicateHitReactEvents", UIMin="1", ClampMin="1", UIMax="32", ClampMax="255"))
+	int32 MaxReplicatedEvents = 8;
+
+	/**
+	 * Events for the same profile that land within this window of the most recent event are merged into it on the server
+	 * Set to 0 to disable coalescing
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="HitReact|Networking", meta=(EditCondition="bReplicateHitReactEvents", UIMin="0", ClampMin="0", UIMax="0.25", Delta="0.01", ForceUnits="s"))
+	float ReplicatedEventCoalesceWindow = 0.05f;
+
+	/** Replicated events older than this are discarded by clients, e.g. when joining late or becoming relevant */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="HitReact|Networking", meta=(EditCondition="bReplicateHitReactEvents", UIMin="0", ClampMin="0", UIMax="1", Delta="0.05", ForceUnits="s"))
+	float ReplicatedEventStaleTime = 0.5f;
 	
+protected:
+	/** Recent hit react events replicated to clients */
+	UPROPERTY(Replicated)
+	FHitReactEventBuffer ReplicatedEvents;
+
 protected:
 	/** Bones currently being simulated */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=HitReact)
 	TArray<FHitReactPhysics> PhysicsBlends;
 
+	/**
+	 * Bones whose bodies have had their blend weight set by us
+	 * Only these are restored on reset, so we don't stomp on simulation owned by other systems
+	 */
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
+	TSet<FName> TouchedBones;
+
+	/** Physics-free spring hit reacts, used beyond the profile's LODThreshold */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=HitReact)
+	TArray<FHitReactSpring> SpringBlends;
+
+	/** Component space rotation per bone from SpringBlends, read by the Hit React Spring anim node */
+	UPROPERTY(Transient)
+	TMap<FName, FQuat> SpringBoneRotations;
+
+	/** Per-bone blend weights from the most recent simulation step */
+	UPROPERTY(Transient)
+	TMap<FName, float> SimulatedBoneWeights;
+
+	/** Per-bone blend weights from the step before SimulatedBoneWeights, for interpolation */
+	UPROPERTY(Transient)
+	TMap<FName, float> PreviousBoneWeights;
+
+	/** Time that has not been simulated yet when using SimulationRate */
+	UPROPERTY(Transient)
+	float SimulationTimeAccumulator = 0.f;
+
 	/** We interpolate the amount of active per-bone blends for averaging, so changes in PhysicsBlends don't cause a snap */
 	UPROPERTY()
 	TMap<FName, float> SmoothedBoneWeights;
@@ -86,10 +204,31 @@ protected:
 	UPROPERTY()
 	FHitReactPendingImpulse PendingImpulse;
 
+	/** Hit react deferred by culling until the mesh is rendered again */
+	UPROPERTY()
+	FHitReactDeferredHitReact DeferredHitReact;
+
+	/** Per-bone blend weights consumed by FAnimNode_HitReactRigidBody when using the AnimNode backend */
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
+	TMap<FName, float> AnimBoneWeights;
+
+	/** Impulses waiting to be consumed by FAnimNode_HitReactRigidBody when using the AnimNode backend */
+	TArray<FHitReactAnimImpulse> AnimImpulses;
+
+	/** Per-body blend weights applied on our last update, for the query functions */
+	TMap<FName, float> ReactingBoneWeights;
+
+	/** Bone with the highest weight in ReactingBoneWeights */
+	FName StrongestReactingBone = NAME_None;
+
 	/** Loaded profiles from AvailableProfiles ready to be used */
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
 	TArray<TObjectPtr<const UHitReactProfile>> ActiveProfiles;
 
+	/** Loaded profiles from ActiveProfiles by their ProfileTag, for HitReactByTag */
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
+	TMap<FGameplayTag, TObjectPtr<const UHitReactProfile>> ProfilesByTag;
+
 	/** Loaded bone data from AvailableBoneData ready to be used */
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
 	TArray<TObjectPtr<const UHitReactBoneData>> ActiveBoneData;
@@ -97,6 +236,12 @@ protected:
 	UPROPERTY()
 	uint64 CurrentId = 0;
 
+	/** Profiles and bone data referenced from UHitReactLoadingSubsystem, released on deactivation */
+	TArray<FSoftObjectPath> SharedAssetPaths;
+
+	/** Incremented for each shared load so that a stale completion is ignored */
+	uint32 SharedAssetRequestId = 0;
+
 	/** True if the profiles have been loaded */
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
 	bool bProfilesLoaded = false;
@@ -113,13 +258,23 @@ protected:
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
 	TMap<TSoftObjectPtr<const UHitReactProfile>, float> LastProfileHitReactTimes;
 
-	/** True if the physical animation profile was changed, and should be removed upon completion of all hit reacts */
+	/** Last time a hit reaction was applied for a specific channel */
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
-	bool bPhysicalAnimationProfileChanged;
+	TMap<FGameplayTag, float> LastChannelHitReactTimes;
 
-	/** True if the constraint profile was changed, and should be removed upon completion of all hit reacts */
+	/**
+	 * Physical animation profile applied to each bone, removed upon completion of all hit reacts
+	 * Used to skip reapplying a profile to a subtree that already has it
+	 */
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
+	TMap<FName, FName> ActivePhysicalAnimProfiles;
+
+	/**
+	 * Constraint profile applied to the constraint of each bone, removed upon completion of all hit reacts
+	 * Used to skip reapplying a profile to a subtree that already has it
+	 */
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
-	bool bConstraintProfileChanged;
+	TMap<FName, FName> ActiveConstraintProfiles;
 
 	/** True if the collision was changed, and should be reverted upon completion of all hit reacts */
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
@@ -129,6 +284,30 @@ protected:
 	UPROPERTY()
 	TEnumAsByte<ECollisionEnabled::Type> DefaultCollisionEnabled;
 
+	/** Reverts the collision enabled state once idle, for the Lazy physics residency policy */
+	FTimerHandle PhysicsIdleTimerHandle;
+
+	/** Wakes us when the next blend state begins, see SleepHitReactFor() */
+	FTimerHandle WakeTimerHandle;
+
+	/** World time we went to sleep with active blends, they catch up on the time since when we wake, or -1 */
+	double BlendSleepStartTime = -1.0;
+
+	/**
+	 * Clock the physics blends are activated at and evaluated against
+	 * Advanced by each step, so it follows the fixed simulation rate, and by the time spent in a hold sleep
+	 */
+	double PhysicsBlendTime = 0.0;
+
+	/** True if bone weights were skipped while the mesh was not rendered, and need to catch up */
+	bool bSkippedBoneWeights = false;
+
+	/** Time skipped while waiting for our turn from UHitReactScheduler */
+	float TimeSlicedDeltaTime = 0.f;
+
+	/** Frames skipped while waiting for our turn from UHitReactScheduler */
+	int32 FramesSinceUpdate = 0;
+
 	/** Mesh to simulate hit reactions on */
 	UPROPERTY(Transient, DuplicateTransient, BlueprintReadOnly, Category="HitReact|References")
 	TObjectPtr<USkeletalMeshComponent> Mesh;
@@ -141,10 +320,25 @@ protected:
 	UPROPERTY(Transient, DuplicateTransient, BlueprintReadOnly, Category="HitReact|References")
 	TObjectPtr<UPhysicalAnimationComponent> PhysicalAnimation;
 
+	/** Physics asset of the Mesh when we bound to it, RecycleHitReact rebinds if it changes */
+	TWeakObjectPtr<const UPhysicsAsset> BoundPhysicsAsset;
+
+	/** Nearest body lookup for HitReactAtLocation, built on first use */
+	mutable FHitReactBodyLookup BodyLookup;
+
 #if WITH_GAMEPLAY_ABILITIES
 	TWeakObjectPtr<class UAbilitySystemComponent> AbilitySystemComponent;
+
+	/** Tag count change events registered on AbilitySystemComponent for GlobalToggle */
+	TArray<TPair<FGameplayTag, FDelegateHandle>> ToggleTagEventHandles;
 #endif
 
+	/** True once the GlobalToggle tag events are registered, so we don't look for the AbilitySystemComponent again */
+	bool bToggleTagEventsRegistered = false;
+
+	/** Sends impulses to the physics thread if bUseAsyncPhysics */
+	FHitReactAsyncPhysics AsyncPhysics;
+
 public:
 	/** Called when the hit react system is toggled on or off */
 	UPROPERTY(BlueprintAssignable, Category=HitReact)
@@ -152,6 +346,42 @@ public:
 
 public:
 	const TArray<FHitReactPhysics>& GetPhysicsBlends() const { return PhysicsBlends; }
+	const TArray<FHitReactSpring>& GetSpringBlends() const { return SpringBlends; }
+
+	/** Component space rotation per bone for the Hit React Spring anim node */
+	const TMap<FName, FQuat>& GetSpringBoneRotations() const { return SpringBoneRotations; }
+
+	EHitReactBackend GetBackend() const { return Backend; }
+
+	/** Per-bone blend weights for the AnimNode backend */
+	const TMap<FName, float>& GetAnimBoneWeights() const { return AnimBoneWeights; }
+
+	/** @return True if the bone's body has a hit react blend weight applied */
+	UFUNCTION(BlueprintPure, BlueprintCosmetic, Category=HitReact)
+	bool IsBoneReacting(FName BoneName) const { return GetBoneReactWeight(BoneName) > 0.f; }
+
+	/** @return Hit react blend weight applied to the bone's body, 0 if it isn't reacting */
+	UFUNCTION(BlueprintPure, BlueprintCosmetic, Category=HitReact)
+	float GetBoneReactWeight(FName BoneName) const { return ReactingBoneWeights.FindRef(BoneName); }
+
+	/** @return Number of active physics blends, excluding springs */
+	UFUNCTION(BlueprintPure, BlueprintCosmetic, Category=HitReact)
+	int32 GetActiveBlendCount() const { return PhysicsBlends.Num(); }
+
+	/** @return Bone with the highest hit react blend weight, None if no bones are reacting */
+	UFUNCTION(BlueprintPure, BlueprintCosmetic, Category=HitReact)
+	FName GetStrongestReactingBone() const { return StrongestReactingBone; }
+
+	/** @return Number of active physics blends whose profile declares the channel */
+	UFUNCTION(BlueprintPure, BlueprintCosmetic, Category=HitReact)
+	int32 GetChannelBlendCount(UPARAM(meta=(Categories="HitReact.Channel")) FGameplayTag Channel) const;
+
+	/** @return Number of bodies simulated by the active physics blends whose profile declares the channel */
+	UFUNCTION(BlueprintPure, BlueprintCosmetic, Category=HitReact)
+	int32 GetChannelBodyCount(UPARAM(meta=(Categories="HitReact.Channel")) FGameplayTag Channel) const;
+
+	/** Move queued impulses for the AnimNode backend into OutImpulses */
+	void ConsumeAnimImpulses(TArray<FHitReactAnimImpulse>& OutImpulses);
 	
 public:
 	UHitReact(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
@@ -167,6 +397,99 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact)
 	bool HitReact(const FHitReactInputParams& Params, FHitReactImpulseParams Impulse,
 		const FHitReactImpulse_WorldParams& World, float ImpulseScalar = 1.f);
+
+	/**
+	 * Trigger a hit reaction using the available profile with the matching ProfileTag
+	 * Params.Profile is ignored, tags are cheap to look up and replicate compared to asset references
+	 * Equivalent to HitReact with Params.ProfileTag set, use that on triggers to replicate the tag
+	 * @param ProfileTag The ProfileTag of the profile to use
+	 * @param Params The hit react input parameters
+	 * @param Impulse The impulse parameters to apply
+	 * @param World The world space parameters to apply
+	 * @param ImpulseScalar Universal scalar to apply to all impulses included in ImpulseParams
+	 * @return True if the hit react was applied
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact)
+	bool HitReactByTag(UPARAM(meta=(Categories="HitReact.Profile")) FGameplayTag ProfileTag, const FHitReactInputParams& Params,
+		FHitReactImpulseParams Impulse, const FHitReactImpulse_WorldParams& World, float ImpulseScalar = 1.f);
+
+	/**
+	 * Apply a hit react to the physics body nearest to WorldLocation
+	 * For hits that don't report a bone, such as capsule hits or radial damage
+	 * @param WorldLocation Where the hit landed
+	 * @param Direction Direction of the hit for linear and angular impulses, radial impulses originate from WorldLocation
+	 * @param Params The hit react input parameters, SimulatedBoneName is replaced by the nearest body's bone
+	 * @param Impulse The impulse parameters to apply
+	 * @param ImpulseScalar Universal scalar to apply to all impulses included in ImpulseParams
+	 * @return True if the hit react was applied
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact)
+	bool HitReactAtLocation(FVector WorldLocation, FVector Direction, const FHitReactInputParams& Params,
+		FHitReactImpulseParams Impulse, float ImpulseScalar = 1.f);
+
+	/** @return Bone of the physics body nearest to WorldLocation, excluding BlacklistedBones, None if there are none */
+	UFUNCTION(BlueprintPure, BlueprintCosmetic, Category=HitReact)
+	FName FindNearestBody(FVector WorldLocation) const;
+
+	/** Find the bone of the physics body nearest to each of WorldLocations, excluding BlacklistedBones */
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact)
+	void FindNearestBodies(const TArray<FVector>& WorldLocations, TArray<FName>& BoneNames) const;
+
+protected:
+	/** Rebuild BodyLookup if the mesh or its physics asset changed, @return True if it has any bodies */
+	bool UpdateBodyLookup() const;
+
+	/** Apply the hit react once the profile is resolved */
+	bool HitReactWithProfile(const FHitReactInputParams& Params, const UHitReactProfile* Profile,
+		const FHitReactImpulseParams& Impulse, const FHitReactImpulse_WorldParams& World, float ImpulseScalar);
+
+public:
+	/**
+	 * Cheap check for whether a hit react with these params would be rejected outright
+	 * Covers the toggle state, cooldowns, LOD and max blends, but not culling or mesh validation
+	 * Use this to skip building triggers and impulses that would be discarded
+	 * @return False if HitReact would reject these params
+	 */
+	UFUNCTION(BlueprintPure, BlueprintCosmetic, Category=HitReact)
+	bool CanHitReactWith(const FHitReactInputParams& Params) const;
+
+protected:
+	/**
+	 * Constant-time rejections that don't depend on the profile
+	 * @param OutRejection Reason for the rejection, if it should be reported
+	 */
+	bool CanAdmitHitReact(const TCHAR** OutRejection = nullptr) const;
+
+	/**
+	 * Constant-time rejections for the profile
+	 * @param OutTier The tier the hit react will be applied with
+	 * @param OutRejection Reason for the rejection, if it should be reported
+	 */
+	bool CanAdmitProfile(const UHitReactProfile* Profile, EHitReactTier& OutTier, const TCHAR** OutRejection = nullptr) const;
+
+	/** @return True if the channel has reached its MaxActiveBlends or MaxSimulatedBodies */
+	bool IsChannelOverBudget(const FGameplayTag& Channel, const FHitReactChannel& ChannelParams) const;
+
+	/** @return Number of physics blends that count against budgets, excluding those being evicted */
+	int32 GetNumAdmittedBlends() const;
+
+	/** @return Number of physics blends counted against the profile's MaxActiveBlends, only its channel's if we configure it */
+	int32 GetProfileBlendCount(const FHitReactCompiledProfile& Compiled) const;
+
+	/** @return Number of bodies simulated by physics blends that count against budgets, excluding those being evicted */
+	int32 GetSimulatedBodyCount() const;
+
+	/**
+	 * Fade out the lowest ranked physics blend to make room for a new hit react
+	 * @param Channel If set, only blends whose profile declares this channel are considered
+	 * @return True if a blend was evicted
+	 */
+	bool EvictPhysicsBlend(const FHitReactEviction& EvictionParams, const FGameplayTag* Channel = nullptr);
+
+	/** @return The loaded profile from ActiveProfiles, or nullptr if not loaded or unavailable */
+	const UHitReactProfile* FindActiveProfile(const TSoftObjectPtr<UHitReactProfile>& Profile) const;
+
+public:
 		
 	/**
 	 * Trigger a hit reaction on the specified bone using FHitReactTrigger Params
@@ -215,15 +538,72 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact, meta=(DisplayName="Hit React Trigger (Radial)"))
 	bool HitReactTrigger_Radial(const FHitReactTrigger_Radial& Params, const FHitReactImpulse_WorldParams& World,
 		float ImpulseScalar = 1.f);
+
+	/**
+	 * Trigger a hit reaction on the server and replicate it to clients via the replicated event buffer
+	 * Applies locally unless we are a dedicated server, then clients apply it when the buffer replicates
+	 * Requires bReplicateHitReactEvents, otherwise it is only applied locally
+	 * @param Params The hit react trigger parameters
+	 * @param World The world space parameters to apply
+	 * @param ImpulseScalar The scalar to apply to the impulse
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category=HitReact)
+	void ReplicateHitReact(const FHitReactTrigger& Params, const FHitReactImpulse_WorldParams& World,
+		float ImpulseScalar = 1.f);
+
+	/** Called on clients when an event is received from the replicated event buffer */
+	virtual void OnReplicatedHitReactEvent(const FHitReactEventItem& Event);
 	
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	void TickGlobalToggle(float DeltaTime);
 
-	void ApplyImpulse(const FHitReactPendingImpulse& Impulse) const;
+public:
+	/**
+	 * Register for changes to GlobalToggle's DisableTags and EnableTags on the owner's AbilitySystemComponent
+	 * Called automatically on initialization, call it again if the AbilitySystemComponent becomes available later
+	 * @return True if registered
+	 */
+	virtual bool RegisterToggleTagEvents();
+
+	/** Unregister the tag events registered by RegisterToggleTagEvents */
+	virtual void UnregisterToggleTagEvents();
+
+protected:
+	/** Toggle the system based on the tags currently owned by the AbilitySystemComponent */
+	void UpdateToggleFromTags();
+
+	/** Called when one of GlobalToggle's tags is added or removed */
+	void OnToggleTagChanged(const FGameplayTag Tag, int32 NewCount);
+
+	/** Advance the physics blends by a single step, updating SimulatedBoneWeights */
+	void StepPhysicsBlends(float DeltaTime);
+
+	/** @return True if we should only advance the blends without updating bone weights, see FHitReactCulling::bSkipWeightsWhenNotRendered */
+	bool ShouldSkipBoneWeights() const;
+
+	/** Advance the physics blends without any per-bone work, removing those that complete */
+	void AdvancePhysicsBlends(float DeltaTime);
+
+	/**
+	 * Evaluate SimulatedBoneWeights directly for the current blend states, without blending from the last step
+	 * Applied to the mesh immediately, including zeros for the bones no blend covers anymore
+	 */
+	void CatchUpBoneWeights();
+
+	/** Apply the deferred hit react once the mesh is rendered again, or drop it if it waited too long */
+	void TickDeferredHitReact();
+
+	/** @return True if we should update every frame even when UHitReactScheduler is time slicing */
+	virtual bool ShouldUpdateEveryFrame() const;
+
+	/** Update the spring hit reacts and the resulting bone rotations */
+	void TickSprings(float DeltaTime);
+
+	void ApplyImpulse(const FHitReactPendingImpulse& Impulse);
 	
 	void ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitReactImpulse_WorldParams& World, float ImpulseScalar,
-		const UHitReactProfile* Profile, FName ImpulseBoneName) const;
+		const UHitReactProfile* Profile, FName ImpulseBoneName);
 
 public:
 	/**
@@ -235,11 +615,27 @@ public:
 	void PreActivate(bool bReset);
 	virtual void PreActivate_Implementation(bool bReset) {}
 	
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 	virtual void Activate(bool bReset) override;
 	virtual void Deactivate() override;
 
 	virtual void OnFinishedLoading() override;
 
+protected:
+	/** Build ProfilesByTag from ActiveProfiles */
+	void BuildProfileTagTable();
+
+	/** Resolve ActiveProfiles and ActiveBoneData from the assets shared by UHitReactLoadingSubsystem */
+	void OnSharedAssetsLoaded();
+
+	/** Release our references to the assets shared by UHitReactLoadingSubsystem */
+	void ReleaseSharedAssets();
+
+public:
+
 	/** Called when the hit react system is initialized */
 	UFUNCTION(BlueprintCallable, Category=HitReact)
 	bool OnHitReactInitialized(FOnHitReactInitialized Delegate);
@@ -307,6 +703,15 @@ protected:
 
 	/** Disable ticking */
 	virtual void SleepHitReact();
+
+	/** Disable ticking until Duration has passed, active blends catch up on the time slept when we wake */
+	void SleepHitReactFor(float Duration);
+
+	/**
+	 * @return Time until the next blend state begins, if the bone weights won't change before then
+	 * Zero if something else needs us to keep ticking
+	 */
+	float GetBlendHoldSleepTime() const;
 	
 public:
 	/**
@@ -314,6 +719,40 @@ public:
 	 * @return True if mesh needs to change to valid collision properties
 	 */
 	bool NeedsCollisionEnabled() const;
+
+	/**
+	 * Switch the mesh to a physics collision mode if required, and mark it as the most recently hit resident
+	 * Cancels any pending idle revert
+	 */
+	void MakePhysicsResident();
+
+	/** Restore the mesh's collision enabled state and stop being resident */
+	virtual void ReleasePhysicsResidency();
+
+	/** @return True if the residency subsystem may evict us to stay within MaxResidentPhysicsMeshes */
+	virtual bool CanEvictPhysicsResidency() const;
+
+	/** @return True if we have switched the mesh to a physics collision mode */
+	bool IsPhysicsResident() const { return bCollisionEnabledChanged; }
+
+protected:
+	void OnPhysicsIdleTimeout();
+
+public:
+	/**
+	 * Determine how to handle a hit react based on Culling
+	 * Runs before the hit react is validated, so must remain cheap
+	 */
+	virtual EHitReactCullResponse GetCullResponse() const;
+
+	/** @return Squared distance from the mesh to the closest local player view, or -1 if there is no local view */
+	float GetDistanceSqToLocalView() const;
+
+	/**
+	 * Determine how much work to spend on a hit react
+	 * Uses the profile's LODThreshold and Spring by default, override to factor in significance
+	 */
+	virtual EHitReactTier GetHitReactTier(const UHitReactProfile* Profile) const;
 	
 public:
 	/** Get the mesh to simulate from the owner */
@@ -336,11 +775,63 @@ public:
 	UFUNCTION(BlueprintPure, BlueprintCosmetic, Category=HitReact)
 	UPhysicalAnimationComponent* GetPhysicalAnimationComponent() const { return PhysicalAnimation; }
 
+protected:
+	/** Iterate the bones with bodies below BoneName, using the physics asset directly for the AnimNode backend */
+	int32 ForEachBone(FName BoneName, bool bIncludeSelf, const TFunctionRef<bool(const FName&)>& Func) const;
+
+	/** @return The current blend weight for the bone from the active backend */
+	float GetCurrentBoneWeight(const FName& BoneName) const;
+
+	/** Queue an impulse for the AnimNode backend, factoring in the body mass unless it is a velocity change */
+	void QueueAnimImpulse(const FName& BoneName, const FVector& Impulse, bool bAngular, bool bVelChange);
+
+	/** Approximate the hit react with a spring on the first valid bone, without touching the mesh's physics state */
+	bool HitReactSpring(const FHitReactInputParams& Params, const FHitReactImpulseParams& Impulse,
+		const FHitReactImpulse_WorldParams& World, float ImpulseScalar, const UHitReactProfile* Profile);
+
+	/**
+	 * Mass properties from the physics asset, does not require the physics state to be created
+	 * Inertia is approximated as a solid sphere bounding the body
+	 */
+	bool GetBoneMassProperties(const FName& BoneName, float& OutMass, float& OutInertia) const;
+
+public:
+	/**
+	 * Return the component to a fresh state for a pooled actor, without reloading profiles
+	 * Clears all active hit reacts, pending impulses and cooldowns, restoring only the bodies we touched
+	 * Only rebinds if the owner's mesh, physics asset or physical animation component changed
+	 * The global toggle state is preserved
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact)
+	virtual void RecycleHitReact();
+
+protected:
+	/** Bind to the mesh's pose initialization and tick after it */
+	void BindToMesh();
+
+	/** Unbind from the mesh, reverting anything we changed on it */
+	void UnbindFromMesh();
+
 protected:
 	UFUNCTION()
 	virtual void OnMeshPoseInitialized();
 
+	UFUNCTION()
+	virtual void OnMeshPhysicsStateChanged(UPrimitiveComponent* ChangedComponent, EComponentPhysicsStateChange StateChange);
+
 	virtual void ResetHitReactSystem();
+
+	/** Zero the blend weight and stop simulating on TouchedBones only */
+	void RestoreTouchedBodies();
+
+	/** Apply the constraint profile to the bones below BoneName that don't already use it */
+	void ApplyConstraintProfileBelow(const FName& BoneName, bool bIncludeSelf, const FName& ProfileName);
+
+	/** Apply the physical animation profile to the bones below BoneName that don't already use it */
+	void ApplyPhysicalAnimProfileBelow(const FName& BoneName, bool bIncludeSelf, const FName& ProfileName);
+
+	/** Revert the constraint and physical animation profiles on every bone we applied them to */
+	void RestoreProfiles();
 	
 protected:
 	bool ShouldCVarDrawDebug(int32 CVarValue) const;
@@ -352,8 +843,12 @@ private:
 	/**
 	 * Notify user of the result of a hit react
 	 * Useful for debugging
+	 * Takes a view so literal results don't allocate a string when p.HitReact.Debug.Result is disabled
 	 */
-	void DebugHitReactResult(const FString& Result, bool bFailed) const;
+	void DebugHitReactResult(FStringView Result, bool bFailed) const;
+
+	/** @return True if p.HitReact.Debug.Result is enabled, so the result string is worth building */
+	bool ShouldDebugHitReactResult() const;
 
 #if WITH_EDITOR
 #if UE_5_03_OR_LATER
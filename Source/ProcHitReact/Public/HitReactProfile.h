@@ -4,7 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
 #include "Params/HitReactParams.h"
+#include "System/HitReactCompiledProfile.h"
 #include "System/HitReactVersioning.h"
 #include "HitReactProfile.generated.h"
 
@@ -23,6 +25,20 @@ public:
 	FString Description;
 #endif
 
+	/**
+	 * Tag used to select this profile with UHitReact::HitReactByTag
+	 * Must be unique among the profiles available to a component
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(Categories="HitReact.Profile"))
+	FGameplayTag ProfileTag;
+
+	/**
+	 * Channel whose budget this profile's hit reacts count against, see UHitReact::Channels
+	 * Leave empty to only use this profile's own limits
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(Categories="HitReact.Channel"))
+	FGameplayTag Channel;
+
 	/**
 	 * The blend parameters to apply
 	 * Interpolation state handling for hit reactions
@@ -63,9 +79,14 @@ public:
 	
 	/**
 	 * Handle the application of this profile based on MaxBlendHandling if there are too many blends already simulating
+	 * If the component configures this profile's Channel, only blends in that channel count, otherwise all blends do
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(UIMin="1", ClampMin="1", EditCondition="MaxBlendHandling != EHitReactMaxBlendHandling::Disabled", EditConditionHides))
 	int32 MaxActiveBlends;
+
+	/** How to choose and fade out an active blend to make room for this profile */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(EditCondition="MaxBlendHandling == EHitReactMaxBlendHandling::Evict", EditConditionHides))
+	FHitReactEviction Eviction;
 	
 	/**
 	 * Scale the impulse based on the number of times the bone has been hit prior to completing the hit react
@@ -98,7 +119,7 @@ public:
 	FName PhysicalAnimProfile;
 
 	/**
-	 * Constraint profile to apply to all bones
+	 * Constraint profile to apply to the constraints of this bone and any below
 	 * This is applied to the physics asset on the mesh
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Physics)
@@ -109,9 +130,18 @@ public:
 	* For example if you have LODThreshold to be 2, it will run until LOD 2 (based on 0 index)
 	* when the component LOD becomes 3, it will stop update/evaluate
 	* currently transition would be issue and that has to be re-visited
+	* If Spring is enabled, hit reacts beyond this LOD use the spring instead
 	*/
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Performance, meta=(DisplayName="LOD Threshold", ClampMin="-1", UIMin="-1"))
 	int32 LODThreshold;
+
+	/** Physics-free fallback for hit reacts beyond LODThreshold */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Performance)
+	FHitReactSpringParams Spring;
+
+protected:
+	/** Compiled copy of this profile in FHitReactProfileTable */
+	mutable FHitReactProfileHandle CompiledHandle;
 	
 public:
 	UHitReactProfile()
@@ -130,6 +160,25 @@ public:
 		, LODThreshold(-1)
 	{}
 
+	/**
+	 * Immutable compiled copy of this profile, read by the hit react hot paths instead of the asset
+	 * Compiled on load, or on first use for profiles created at runtime, which must be on the game thread
+	 */
+	const FHitReactCompiledProfile& GetCompiled() const;
+
+	/** Shared reference to GetCompiled(), for anything that must outlive a recompile, e.g. an active blend */
+	FHitReactCompiledProfilePtr GetCompiledShared() const;
+
+	/** Handle to the compiled copy of this profile in FHitReactProfileTable */
+	FHitReactProfileHandle GetCompiledHandle() const;
+
+	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 #if WITH_EDITOR
 #if UE_5_03_OR_LATER
 	virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
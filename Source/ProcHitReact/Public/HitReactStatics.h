@@ -36,10 +36,22 @@ public:
 	/** Convenience wrapper for Mesh->ForEachBodyBelow */
 	static int32 ForEach(USkeletalMeshComponent* Mesh, FName BoneName, bool bIncludeSelf, const TFunctionRef<bool(FBodyInstance*)>& Func);
 
+	/** Same as ForEach, but iterates the physics asset instead of the mesh's bodies, so it does not require a physics state */
+	static int32 ForEachBodySetup(const USkeletalMeshComponent* Mesh, FName BoneName, bool bIncludeSelf, const TFunctionRef<bool(const FName&)>& Func);
+
 public:
-	/** Finalize the physics state of the mesh, must be called after modifying blend weights or simulate physics state */
+	/**
+	 * Finalize the physics state of the mesh, must be called after modifying blend weights or simulate physics state
+	 * Tick registration is only updated when SetBlendWeight changed the mesh between zero and non-zero weighted bodies, or the mesh wasn't tracked yet
+	 */
 	static void FinalizeMeshPhysics(USkeletalMeshComponent* Mesh);
 
+	/**
+	 * Forget the weighted bodies tracked by SetBlendWeight, call when weights are reset without it or the bodies are destroyed
+	 * They are counted from the mesh again by the next FinalizeMeshPhysics
+	 */
+	static void ResetWeightedBodies(const USkeletalMeshComponent* Mesh);
+
 	/** Accumulate the blend weight for the given bone */
 	static bool AccumulateBlendWeight(const USkeletalMeshComponent* Mesh, const FName& BoneName, float BlendWeight, float ClampBlendWeight, float Alpha);
 
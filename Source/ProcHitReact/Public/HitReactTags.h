@@ -23,4 +23,8 @@ namespace FHitReactTags
   	PROCHITREACT_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(HitReact_Profile_Twitch_NoLegs);
   	PROCHITREACT_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(HitReact_Profile_Twitch_NoLimbs);
   	PROCHITREACT_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(HitReact_Profile_Flop);
+
+	PROCHITREACT_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(HitReact_Channel_Locomotion);
+	PROCHITREACT_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(HitReact_Channel_Damage);
+	PROCHITREACT_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(HitReact_Channel_Explosion);
 }
\ No newline at end of file
@@ -25,4 +25,61 @@ enum class EHitReactMaxBlendHandling : uint8
 	Disabled			UMETA(ToolTip="Apply the hit react regardless of how many blends are active"),
 	ImpulseOnly			UMETA(ToolTip="Only apply the impulse without modifying bone blend weights"),
 	Blocked				UMETA(ToolTip="Block the hit react if the maximum number of blends are active"),
+	Evict				UMETA(ToolTip="Fade out the lowest ranked active blend to make room for the hit react"),
+};
+
+/**
+ * Which active blend is evicted first to make room for a new hit react
+ */
+UENUM(BlueprintType)
+enum class EHitReactEvictionRanking : uint8
+{
+	Weakest				UMETA(ToolTip="Evict the blend with the lowest requested blend weight"),
+	Oldest				UMETA(ToolTip="Evict the blend with the least time remaining"),
+};
+
+/**
+ * How hit reacts are simulated
+ */
+UENUM(BlueprintType)
+enum class EHitReactBackend : uint8
+{
+	Physics				UMETA(ToolTip="Blend physics bodies on the mesh in the world physics scene"),
+	AnimNode			UMETA(DisplayName="Anim Node", ToolTip="Simulate locally in the Anim Graph using the Hit React RigidBody node, without touching the world physics scene"),
+};
+
+/**
+ * When the mesh's collision is switched to a physics mode for hit reacts
+ * Each switch can recreate the physics state for the entire mesh
+ */
+UENUM(BlueprintType)
+enum class EHitReactPhysicsResidency : uint8
+{
+	Lazy				UMETA(ToolTip="Enable physics collision on the first hit react, and revert it once idle for IdleTimeout"),
+	Prewarm				UMETA(ToolTip="Enable physics collision when the component initializes so the first hit react doesn't hitch, it is only reverted if evicted"),
+	KeepEnabled			UMETA(ToolTip="Enable physics collision on the first hit react and never revert it, it is never evicted"),
+};
+
+/**
+ * How much work to spend on a hit react, chosen by UHitReact::GetHitReactTier()
+ */
+UENUM(BlueprintType)
+enum class EHitReactTier : uint8
+{
+	Full				UMETA(ToolTip="Simulate the hit react using the component's Backend"),
+	Spring				UMETA(ToolTip="Approximate the hit react with a damped spring evaluated by the Hit React Spring anim node, without any physics bodies"),
+	None				UMETA(ToolTip="Reject the hit react"),
+};
+
+/**
+ * How to handle a hit react that is unlikely to be seen
+ * Ordered from least to most restrictive
+ */
+UENUM(BlueprintType)
+enum class EHitReactCullResponse : uint8
+{
+	Apply				UMETA(ToolTip="Apply the hit react as normal"),
+	Defer				UMETA(ToolTip="Hold the hit react until the mesh is rendered again, it is dropped if that takes too long"),
+	ImpulseOnly			UMETA(ToolTip="Only apply the impulse to bodies that are already simulating, without starting a new blend"),
+	Drop				UMETA(ToolTip="Drop the hit react entirely"),
 };
\ No newline at end of file
@@ -0,0 +1,101 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Params/HitReactImpulse.h"
+#include "Params/HitReactTrigger.h"
+#include "HitReactEventBuffer.generated.h"
+
+class UHitReact;
+struct FHitReactEventBuffer;
+
+/**
+ * A single replicated hit react event
+ * May represent several events that were coalesced on the server
+ */
+USTRUCT()
+struct PROCHITREACT_API FHitReactEventItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	FHitReactEventItem()
+		: ImpulseScalar(1.f)
+		, ServerTime(0.f)
+		, NumCoalesced(1)
+	{}
+
+	/** The hit react to trigger */
+	UPROPERTY()
+	FHitReactTrigger Trigger;
+
+	/** World space parameters for the impulse */
+	UPROPERTY()
+	FHitReactImpulse_WorldParams World;
+
+	/** Scalar to apply to the impulse */
+	UPROPERTY()
+	float ImpulseScalar;
+
+	/** Server world time when this event was first written */
+	UPROPERTY()
+	float ServerTime;
+
+	/** Number of events coalesced into this one */
+	UPROPERTY()
+	uint8 NumCoalesced;
+
+	/** Assign the event payload without touching the replication state */
+	void SetEvent(const FHitReactTrigger& InTrigger, const FHitReactImpulse_WorldParams& InWorld, float InImpulseScalar,
+		float InServerTime);
+
+	void PostReplicatedAdd(const FHitReactEventBuffer& InArraySerializer);
+	void PostReplicatedChange(const FHitReactEventBuffer& InArraySerializer);
+};
+
+/**
+ * Replicated, bounded ring buffer of recent hit react events
+ * Replaces one multicast per hit with a single delta-replicated property update per net update
+ */
+USTRUCT()
+struct PROCHITREACT_API FHitReactEventBuffer : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	FHitReactEventBuffer()
+		: OwnerComponent(nullptr)
+		, LastIndex(INDEX_NONE)
+	{}
+
+	UPROPERTY()
+	TArray<FHitReactEventItem> Items;
+
+	/** Component that consumes replicated events */
+	UHitReact* OwnerComponent;
+
+	/**
+	 * Write an event to the buffer, overwriting the oldest event once MaxEvents is reached
+	 * Events for the same profile within CoalesceWindow of the most recent event are merged into it
+	 */
+	void AddEvent(const FHitReactTrigger& Trigger, const FHitReactImpulse_WorldParams& World, float ImpulseScalar,
+		float ServerTime, int32 MaxEvents, float CoalesceWindow);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FastArrayDeltaSerialize<FHitReactEventItem, FHitReactEventBuffer>(Items, DeltaParms, *this);
+	}
+
+private:
+	/** Most recently written slot, server only */
+	int32 LastIndex;
+};
+
+template<>
+struct TStructOpsTypeTraits<FHitReactEventBuffer> : public TStructOpsTypeTraitsBase2<FHitReactEventBuffer>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
@@ -302,13 +302,8 @@ struct PROCHITREACT_API FHitReactImpulse_WorldParams
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadWrite, Category=Physics)
 	FVector RadialLocation;
 
-	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
-	{
-		LinearDirection.NetSerialize(Ar, Map, bOutSuccess);
-		AngularDirection.NetSerialize(Ar, Map, bOutSuccess);
-		RadialLocation.NetSerialize(Ar, Map, bOutSuccess);
-		return !Ar.IsError();
-	}
+	/** Directions are unit vectors, sent as 16-bit fixed point per component like FVector_NetQuantizeNormal */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
 };
 
 template<>
@@ -362,4 +357,26 @@ struct PROCHITREACT_API FHitReactPendingImpulse
 	{
 		return Profile && Impulse.CanBeApplied();
 	}
-};
\ No newline at end of file
+};
+
+/**
+ * Impulse queued for FAnimNode_HitReactRigidBody
+ * World space, with mass already factored in
+ */
+struct PROCHITREACT_API FHitReactAnimImpulse
+{
+	FHitReactAnimImpulse(const FName& InBoneName = NAME_None, const FVector& InImpulse = FVector::ZeroVector, bool bInAngular = false)
+		: BoneName(InBoneName)
+		, Impulse(InImpulse)
+		, bAngular(bInAngular)
+	{}
+
+	/** Bone to apply the impulse to */
+	FName BoneName;
+
+	/** Linear impulse, or angular impulse in radians */
+	FVector Impulse;
+
+	/** True if Impulse is an angular impulse */
+	bool bAngular;
+};
@@ -6,6 +6,7 @@
 #include "GameplayTagContainer.h"
 #include "HitReactTypes.h"
 #include "Physics/HitReactPhysicsState.h"
+#include "System/HitReactNetRegistry.h"
 #include "UObject/SoftObjectPtr.h"
 #include "HitReactParams.generated.h"
 
@@ -54,6 +55,223 @@ struct PROCHITREACT_API FHitReactGlobalToggle
 	FHitReactPhysicsStateSimple State;
 };
 
+/**
+ * Client-side culling for hit reacts that nobody will see
+ * Evaluated before the hit react is validated or the mesh is modified, the most restrictive response applies
+ * The locally controlled player is never culled
+ */
+USTRUCT(BlueprintType)
+struct PROCHITREACT_API FHitReactCulling
+{
+	GENERATED_BODY()
+
+	FHitReactCulling()
+		: bEnableCulling(false)
+		, RecentlyRenderedTolerance(0.2f)
+		, NotRenderedResponse(EHitReactCullResponse::Defer)
+		, MaxDeferTime(0.25f)
+		, FarDistance(3000.f)
+		, FarResponse(EHitReactCullResponse::ImpulseOnly)
+		, CullDistance(6000.f)
+		, CullResponse(EHitReactCullResponse::Drop)
+		, bSkipWeightsWhenNotRendered(false)
+	{}
+
+	/** If true, hit reacts are culled based on rendering and distance to the local view */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	bool bEnableCulling;
+
+	/** The mesh is considered not rendered if it has not been rendered within this time */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableCulling || bSkipWeightsWhenNotRendered", UIMin="0", ClampMin="0", UIMax="1", Delta="0.05", ForceUnits="s"))
+	float RecentlyRenderedTolerance;
+
+	/** Response when the mesh has not been rendered recently */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableCulling"))
+	EHitReactCullResponse NotRenderedResponse;
+
+	/** Deferred hit reacts are dropped if the mesh is not rendered again within this time */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableCulling", UIMin="0", ClampMin="0", UIMax="1", Delta="0.05", ForceUnits="s"))
+	float MaxDeferTime;
+
+	/**
+	 * Hit reacts further than this from the closest local view use FarResponse
+	 * Set to 0 to disable
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableCulling", UIMin="0", ClampMin="0", ForceUnits="cm"))
+	float FarDistance;
+
+	/** Response when further than FarDistance from the closest local view */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableCulling"))
+	EHitReactCullResponse FarResponse;
+
+	/**
+	 * Hit reacts further than this from the closest local view use CullResponse
+	 * Set to 0 to disable
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableCulling", UIMin="0", ClampMin="0", ForceUnits="cm"))
+	float CullDistance;
+
+	/** Response when further than CullDistance from the closest local view */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableCulling"))
+	EHitReactCullResponse CullResponse;
+
+	/**
+	 * If true, while the mesh is not rendered active hit reacts only advance their blends, without updating any bone weights
+	 * The bone weights are evaluated for the current time once it is rendered again
+	 * Does not require bEnableCulling, pair it with an ImpulseOnly NotRenderedResponse to also skip new blends
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	bool bSkipWeightsWhenNotRendered;
+};
+
+/**
+ * Controls how long the mesh keeps a physics collision mode after hit reacts
+ * Only applies if the mesh isn't already using a physics collision mode
+ * The number of resident meshes per world is capped by MaxResidentPhysicsMeshes in the Hit React project settings
+ */
+USTRUCT(BlueprintType)
+struct PROCHITREACT_API FHitReactPhysicsResidency
+{
+	GENERATED_BODY()
+
+	FHitReactPhysicsResidency()
+		: Policy(EHitReactPhysicsResidency::Lazy)
+		, IdleTimeout(1.f)
+	{}
+
+	/** When to switch the mesh's collision to a physics mode, and when to revert it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	EHitReactPhysicsResidency Policy;
+
+	/**
+	 * Time without any active hit reacts before the collision is reverted
+	 * Prevents switching back and forth when hit repeatedly
+	 * Set to 0 to revert as soon as the last hit react completes
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="Policy==EHitReactPhysicsResidency::Lazy", EditConditionHides, UIMin="0", ClampMin="0", UIMax="5", Delta="0.1", ForceUnits="s"))
+	float IdleTimeout;
+};
+
+/**
+ * How an active blend is chosen and faded out to make room for a new hit react
+ */
+USTRUCT(BlueprintType)
+struct PROCHITREACT_API FHitReactEviction
+{
+	GENERATED_BODY()
+
+	FHitReactEviction()
+		: Ranking(EHitReactEvictionRanking::Weakest)
+		, FadeTime(0.1f)
+	{}
+
+	/** Which active blend is evicted first */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	EHitReactEvictionRanking Ranking;
+
+	/**
+	 * Time to blend out the evicted blend from its current weight
+	 * Set to 0 to stop it immediately, its bone weights still blend out at the profile's BoneBlendRate
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(UIMin="0", ClampMin="0", UIMax="0.5", Delta="0.05", ForceUnits="s"))
+	float FadeTime;
+};
+
+/**
+ * Independent budget for the hit reacts whose profile declares a channel
+ * Bounds the cost of each category so cheap reactions can't crowd out important ones
+ */
+USTRUCT(BlueprintType)
+struct PROCHITREACT_API FHitReactChannel
+{
+	GENERATED_BODY()
+
+	FHitReactChannel()
+		: MaxActiveBlends(0)
+		, MaxSimulatedBodies(0)
+		, Cooldown(0.f)
+		, MaxBlendHandling(EHitReactMaxBlendHandling::Blocked)
+	{}
+
+	/**
+	 * Maximum number of physics blends active in this channel before MaxBlendHandling applies
+	 * Set to 0 for no limit
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(UIMin="0", ClampMin="0"))
+	int32 MaxActiveBlends;
+
+	/**
+	 * Maximum number of bodies simulated by this channel's physics blends before MaxBlendHandling applies
+	 * Set to 0 for no limit
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(UIMin="0", ClampMin="0"))
+	int32 MaxSimulatedBodies;
+
+	/** Hit reacts will not trigger until Cooldown has lapsed when repeating this channel */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(UIMin="0", ClampMin="0", UIMax="1", Delta="0.01", ForceUnits="s"))
+	float Cooldown;
+
+	/** How to handle hit reacts in this channel once it reaches MaxActiveBlends or MaxSimulatedBodies */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	EHitReactMaxBlendHandling MaxBlendHandling;
+
+	/** How to choose and fade out a blend in this channel to make room */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="MaxBlendHandling==EHitReactMaxBlendHandling::Evict", EditConditionHides))
+	FHitReactEviction Eviction;
+};
+
+/**
+ * Cheap fallback for distant characters
+ * Rotates the simulated bone with a damped spring driven by the impulse, scaled by the profile's blend envelope
+ * Requires the Hit React Spring node in the Anim Graph
+ */
+USTRUCT(BlueprintType)
+struct PROCHITREACT_API FHitReactSpringParams
+{
+	GENERATED_BODY()
+
+	FHitReactSpringParams()
+		: bEnableSpring(false)
+		, SpringLODThreshold(-1)
+		, Stiffness(150.f)
+		, DampingRatio(0.4f)
+		, LeverLength(50.f)
+		, ImpulseScalar(1.f)
+		, MaxAngle(25.f)
+	{}
+
+	/** If true, hit reacts beyond the profile's LODThreshold use the spring instead of being rejected */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	bool bEnableSpring;
+
+	/**
+	 * Max LOD that the spring is allowed to run, beyond this the hit react is rejected
+	 * Set to -1 to disable
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableSpring", DisplayName="Spring LOD Threshold", ClampMin="-1", UIMin="-1"))
+	int32 SpringLODThreshold;
+
+	/** How strongly the bone returns to the animated pose */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableSpring", UIMin="1", ClampMin="1", UIMax="500"))
+	float Stiffness;
+
+	/** 1 is critically damped, lower values overshoot and wobble */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableSpring", UIMin="0", ClampMin="0", UIMax="1", Delta="0.05"))
+	float DampingRatio;
+
+	/** Distance above the bone that linear impulses are treated as acting on, shorter levers rotate further */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableSpring", UIMin="1", ClampMin="1", UIMax="200", ForceUnits="cm"))
+	float LeverLength;
+
+	/** Scale the impulse before it is applied to the spring */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableSpring", UIMin="0", ClampMin="0", UIMax="2", Delta="0.05", ForceUnits="x"))
+	float ImpulseScalar;
+
+	/** Maximum rotation away from the animated pose */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(EditCondition="bEnableSpring", UIMin="0", ClampMin="0", UIMax="90", ClampMax="180", ForceUnits="deg"))
+	float MaxAngle;
+};
+
 /**
  * Subsequent impulse scalar to apply to a bone after the first impulse when hit multiple times
  */
@@ -136,6 +354,13 @@ struct PROCHITREACT_API FHitReactInputParams
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
 	TSoftObjectPtr<UHitReactProfile> Profile;
 
+	/**
+	 * If valid, use the available profile with this ProfileTag instead of Profile
+	 * Replicates as a gameplay tag net index instead of the profile, set by HitReactByTag
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(Categories="HitReact.Profile"))
+	FGameplayTag ProfileTag;
+
 	/** Optional additional BoneData to provide for the profile to append */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
 	TSoftObjectPtr<UHitReactBoneData> BoneData;
@@ -165,16 +390,17 @@ struct PROCHITREACT_API FHitReactInputParams
 
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
-		Ar << Profile;
-		Ar << BoneData;
-		Ar << SimulatedBoneName;
-		Ar << ImpulseBoneName;
-		Ar << bIncludeSelf;
+		// Registered profiles, bone data and bones replicate as compact indices
+		FHitReactNetRegistry::NetSerializeProfileOrTag(Ar, Profile, ProfileTag);
+		FHitReactNetRegistry::NetSerializeBoneData(Ar, BoneData);
+		FHitReactNetRegistry::NetSerializeBoneName(Ar, SimulatedBoneName);
+		FHitReactNetRegistry::NetSerializeBoneName(Ar, ImpulseBoneName);
+		Ar.SerializeBits(&bIncludeSelf, 1);
 		return !Ar.IsError();
 	}
 
 	operator bool() const { return IsValidToApply(); }
-	bool IsValidToApply() const { return !Profile.IsNull() && !SimulatedBoneName.IsNone(); }
+	bool IsValidToApply() const { return (!Profile.IsNull() || ProfileTag.IsValid()) && !SimulatedBoneName.IsNone(); }
 	
 	const FName& GetImpulseBoneName() const
 	{
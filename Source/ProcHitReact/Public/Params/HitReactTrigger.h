@@ -45,9 +45,9 @@ struct PROCHITREACT_API FHitReactTrigger : public FHitReactInputParams
 		// Only serialize any params if they are actually being applied
 		if (Impulse.LinearImpulse || Impulse.AngularImpulse || Impulse.RadialImpulse)
 		{
-			Ar << Profile;
-			Ar << SimulatedBoneName;
-			Ar << bIncludeSelf;
+			FHitReactNetRegistry::NetSerializeProfileOrTag(Ar, Profile, ProfileTag);
+			FHitReactNetRegistry::NetSerializeBoneName(Ar, SimulatedBoneName);
+			Ar.SerializeBits(&bIncludeSelf, 1);
 			Impulse.NetSerialize(Ar, Map, bOutSuccess);
 		}
 		return !Ar.IsError();
@@ -94,9 +94,9 @@ struct PROCHITREACT_API FHitReactTrigger_Linear : public FHitReactInputParams
 		// Only serialize any params if they are actually being applied
 		if (LinearImpulse)
 		{
-			Ar << Profile;
-			Ar << SimulatedBoneName;
-			Ar << bIncludeSelf;
+			FHitReactNetRegistry::NetSerializeProfileOrTag(Ar, Profile, ProfileTag);
+			FHitReactNetRegistry::NetSerializeBoneName(Ar, SimulatedBoneName);
+			Ar.SerializeBits(&bIncludeSelf, 1);
 			LinearImpulse.NetSerialize(Ar, Map, bOutSuccess);
 		}
 		return !Ar.IsError();
@@ -143,9 +143,9 @@ struct PROCHITREACT_API FHitReactTrigger_Angular : public FHitReactInputParams
 		// Only serialize any params if they are actually being applied
 		if (AngularImpulse)
 		{
-			Ar << Profile;
-			Ar << SimulatedBoneName;
-			Ar << bIncludeSelf;
+			FHitReactNetRegistry::NetSerializeProfileOrTag(Ar, Profile, ProfileTag);
+			FHitReactNetRegistry::NetSerializeBoneName(Ar, SimulatedBoneName);
+			Ar.SerializeBits(&bIncludeSelf, 1);
 			AngularImpulse.NetSerialize(Ar, Map, bOutSuccess);
 		}
 		return !Ar.IsError();
@@ -192,9 +192,9 @@ struct PROCHITREACT_API FHitReactTrigger_Radial : public FHitReactInputParams
 		// Only serialize any params if they are actually being applied
 		if (RadialImpulse)
 		{
-			Ar << Profile;
-			Ar << SimulatedBoneName;
-			Ar << bIncludeSelf;
+			FHitReactNetRegistry::NetSerializeProfileOrTag(Ar, Profile, ProfileTag);
+			FHitReactNetRegistry::NetSerializeBoneName(Ar, SimulatedBoneName);
+			Ar.SerializeBits(&bIncludeSelf, 1);
 			RadialImpulse.NetSerialize(Ar, Map, bOutSuccess);
 		}
 		return !Ar.IsError();
@@ -202,4 +202,44 @@ struct PROCHITREACT_API FHitReactTrigger_Radial : public FHitReactInputParams
 
 	FHitReactImpulse& GetImpulseParamsBase(const EHitReactImpulseType& ImpulseType) { return RadialImpulse; }
 	const FHitReactImpulse& GetImpulseParamsBase(const EHitReactImpulseType& ImpulseType) const { return RadialImpulse; }
-};
\ No newline at end of file
+};
+
+/**
+ * A hit react that was deferred by culling until the mesh is rendered again
+ */
+USTRUCT()
+struct PROCHITREACT_API FHitReactDeferredHitReact
+{
+	GENERATED_BODY()
+
+	FHitReactDeferredHitReact()
+		: ImpulseScalar(1.f)
+		, Time(-1.f)
+	{}
+
+	/** The hit react input parameters */
+	UPROPERTY()
+	FHitReactInputParams Params;
+
+	/** Impulse parameters */
+	UPROPERTY()
+	FHitReactImpulseParams Impulse;
+
+	/** World space parameters */
+	UPROPERTY()
+	FHitReactImpulse_WorldParams World;
+
+	/** Scalar to apply to the impulse */
+	UPROPERTY()
+	float ImpulseScalar;
+
+	/** World time when the hit react was deferred */
+	UPROPERTY()
+	float Time;
+
+	/** @return True if a hit react is waiting */
+	bool IsValid() const
+	{
+		return Time >= 0.f;
+	}
+};
@@ -0,0 +1,61 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+class FHitReactAsyncCallback;
+class UPrimitiveComponent;
+class USkeletalMeshComponent;
+struct FBodyInstance;
+
+namespace Chaos
+{
+	class FPBDRigidsSolver;
+}
+
+/**
+ * Routes impulses to the physics thread when the physics scene runs async
+ * Everything queued during a frame is sent as a single sim callback input, and applied in order before the next physics step
+ * Simulate state stays on the game thread, so the body instance and its proxy agree on it
+ */
+struct PROCHITREACT_API FHitReactAsyncPhysics
+{
+	FHitReactAsyncPhysics()
+		: Callback(nullptr)
+		, Solver(nullptr)
+	{}
+
+	/**
+	 * Register with the world's physics solver
+	 * @return False if the solver is not running async physics, in which case nothing is registered
+	 */
+	bool Initialize(const UWorld* World);
+
+	/** Unregister from the physics solver */
+	void Release();
+
+	/** @return True if registered, and commands will be routed to the physics thread */
+	bool IsValid() const { return Callback != nullptr; }
+
+	/** Add a linear impulse to the body on the physics thread */
+	void AddImpulse(const FBodyInstance* BI, const FVector& Impulse, bool bVelChange) const;
+
+	/** Add an angular impulse to the body on the physics thread */
+	void AddAngularImpulseInRadians(const FBodyInstance* BI, const FVector& Impulse, bool bVelChange) const;
+
+	/** Add a radial impulse to every body on the mesh on the physics thread */
+	void AddRadialImpulse(const USkeletalMeshComponent* Mesh, const FVector& Origin, float Radius, float Strength,
+		ERadialImpulseFalloff Falloff, bool bVelChange) const;
+
+	/**
+	 * Drop everything queued this frame for the component's bodies
+	 * Must be called when its physics state is destroyed, before the queued input is sent to the physics thread
+	 */
+	void DropCommands(const UPrimitiveComponent* Component) const;
+
+private:
+	FHitReactAsyncCallback* Callback;
+	Chaos::FPBDRigidsSolver* Solver;
+};
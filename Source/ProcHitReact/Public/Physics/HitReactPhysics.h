@@ -6,6 +6,9 @@
 #include "HitReactPhysicsState.h"
 #include "HitReactPhysics.generated.h"
 
+class UHitReactProfile;
+struct FHitReactCompiledProfile;
+
 /**
  * Process hit reactions on a single bone
  * This is the core system that handles impulse application, physics blend weights, and interpolation
@@ -18,9 +21,12 @@ struct PROCHITREACT_API FHitReactPhysics
 	FHitReactPhysics()
 		: SimulatedBoneName(NAME_None)
 		, Profile(nullptr)
+		, CompiledProfile(nullptr)
 		, Mesh(nullptr)
 		, RequestedBlendWeight(0.f)
 		, MaxBlendWeight(0.f)
+		, NumSimulatedBodies(0)
+		, bEvicted(false)
 		, UniqueId(0)
 	{}
 
@@ -37,6 +43,9 @@ public:
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Physics)
 	TObjectPtr<const UHitReactProfile> Profile;
 
+	/** Compiled copy of Profile read while ticking, held so that it survives the profile recompiling */
+	TSharedPtr<const FHitReactCompiledProfile, ESPMode::ThreadSafe> CompiledProfile;
+
 public:
 	/** Mesh to apply the hit reaction to */
 	UPROPERTY()
@@ -50,6 +59,14 @@ public:
 	UPROPERTY()
 	float MaxBlendWeight;
 
+	/** Number of bodies simulated by this blend, counted against its channel's budget */
+	UPROPERTY()
+	int32 NumSimulatedBodies;
+
+	/** True if fading out to make room for another hit react, it no longer counts against any budget */
+	UPROPERTY()
+	bool bEvicted;
+
 	/** Used for comparison */
 	UPROPERTY()
 	uint64 UniqueId;
@@ -64,13 +81,22 @@ public:
 	TMap<FName, float> BoneWeightScalars = {};
 
 public:
-	/** Apply a hit reaction to the bone */
+	/**
+	 * Apply a hit reaction to the bone
+	 * @param InStartTime Time on the owner's blend clock to start at, later evaluations are against the same clock
+	 */
 	void HitReact(USkeletalMeshComponent* InMesh, const TObjectPtr<const UHitReactProfile>& InProfile, const FName& BoneName,
-		const TArray<FName>& InDisabledBones, const TMap<FName, float>& InBoneWeightScalars);
+		const TArray<FName>& InDisabledBones, const TMap<FName, float>& InBoneWeightScalars, double InStartTime = 0.0);
 
 	/** Tick the hit reaction */
 	void Tick(float DeltaTime);
 
+	/** Evaluate the hit reaction at InTime, blend states are closed-form so this may skip ahead any amount */
+	void Evaluate(double InTime);
+
+	/** Fade out from the current blend weight over FadeTime to make room for another hit react */
+	void Evict(float FadeTime);
+
 	/** @return True if the hit reaction is active */
 	bool IsActive() const;
 
@@ -134,6 +134,7 @@ struct PROCHITREACT_API FHitReactPhysicsStateParams
 /**
  * Interpolation state handling for hit reactions
  * Supports blend in, hold, and blend out
+ * The state is a function of time since activation, so it can be evaluated for any time without ticking
  */
 USTRUCT(BlueprintType)
 struct PROCHITREACT_API FHitReactPhysicsState
@@ -144,6 +145,10 @@ struct PROCHITREACT_API FHitReactPhysicsState
 		: BlendState(EHitReactBlendState::Pending)
 		, ElapsedTime(0.f)
 		, DecayTime(0.f)
+		, StartTime(0.0)
+		, AnchorTime(0.0)
+		, AnchorElapsedTime(0.f)
+		, EvaluatedTime(0.0)
 	{}
 
 	UPROPERTY()
@@ -160,13 +165,32 @@ protected:
 	UPROPERTY(Transient)
 	float ElapsedTime;
 
-	/** Decay is applied when the HitReact is reapplied, effectively an offset applied over time */
+	/** Decay is applied when the HitReact is reapplied, effectively an offset applied over time, starting from AnchorTime */
 	UPROPERTY(Transient)
 	float DecayTime;
 
+	/** Time at which ElapsedTime was zero, accounting for any decay */
+	UPROPERTY(Transient)
+	double StartTime;
+
+	/** Time that ElapsedTime or DecayTime were last set directly */
+	UPROPERTY(Transient)
+	double AnchorTime;
+
+	/** ElapsedTime at AnchorTime, decay rewinds from here */
+	UPROPERTY(Transient)
+	float AnchorElapsedTime;
+
+	/** Time the state was last evaluated for */
+	UPROPERTY(Transient)
+	double EvaluatedTime;
+
 	/** Update the State based on the elapsed time */
 	void UpdateBlendState();
 
+	/** Set the elapsed time and remaining decay as of EvaluatedTime, from which later times are evaluated */
+	void SetAnchor(float InElapsedTime, float InDecayTime);
+
 public:
 	/** @return Current state of the HitReact */
 	EHitReactBlendState GetBlendState() const
@@ -182,6 +206,27 @@ public:
 	{
 		return ElapsedTime;
 	}
+
+	/** @return Time at which ElapsedTime was zero, accounting for any decay */
+	double GetStartTime() const
+	{
+		return StartTime;
+	}
+
+	/** @return Time the state was last evaluated for */
+	double GetEvaluatedTime() const
+	{
+		return EvaluatedTime;
+	}
+
+	/** @return Time at which the HitReact will complete, unless it is decayed or set directly */
+	double GetCompletionTime() const
+	{
+		return StartTime + GetTotalTime();
+	}
+
+	/** @return Time at which the current state ends, or decay completes, from which the blend weight changes */
+	double GetNextStateTime() const;
 	
 	/** @return Total time for the entire blend */
 	float GetTotalTime() const
@@ -215,20 +260,27 @@ public:
 	/**
 	 * Activate the HitReact
 	 * Do not call without checking CanActivate first -- divide by zero will occur
+	 * @param InStartTime Time to activate at, later evaluated times are relative to this
 	 */
-	void Activate();
+	void Activate(double InStartTime = 0.0);
 
 	/** Finish the HitReact by moving the ElapsedTime to the Total Time, and setting BlendState to Completed */
 	void Finish();
 
+	/**
+	 * Replace the remaining blend with a linear blend out from the current alpha over FadeTime
+	 * Finishes immediately if FadeTime is 0
+	 */
+	void FadeOut(float FadeTime);
+
 	/** @return Total blend time for the current state */
 	float GetBlendTime() const;
 
 	// /** Apply a decay, which will cause us to rewind over time */
 	// void Decay()
 	// {
-	// 	DecayTime += Params.DecayTime;
-	// 	DecayTime = FMath::Clamp<float>(DecayTime, 0.f, Params.MaxAccumulatedDecayTime);
+	// 	const float RemainingDecayTime = GetRemainingDecayTime() + Params.DecayTime;
+	// 	SetAnchor(ElapsedTime, FMath::Clamp<float>(RemainingDecayTime, 0.f, Params.MaxAccumulatedDecayTime));
 	// }
 
 	/** @return True if decaying */
@@ -237,6 +289,12 @@ public:
 		return DecayTime > 0.f;
 	}
 
+	/** @return Decay remaining as of EvaluatedTime */
+	float GetRemainingDecayTime() const
+	{
+		return FMath::Max<float>(0.f, AnchorTime + DecayTime - EvaluatedTime);
+	}
+
 	/** Directly set the elapsed time and Update the State */
 	void SetElapsedTime(float InElapsedTime);
 
@@ -258,10 +316,19 @@ public:
 	const FHitReactBlendParams* GetBlendParams() const;
 
 	/**
-	 * Called every frame to update the state
+	 * Update the state for the given time, the result does not depend on how often this is called
 	 * @return True if completed and ready to disable, remove, uninitialize, etc.
 	 */
-	bool Tick(float DeltaTime);
+	bool Evaluate(double InTime);
+
+	/**
+	 * Called every frame to update the state, evaluates DeltaTime after the last evaluated time
+	 * @return True if completed and ready to disable, remove, uninitialize, etc.
+	 */
+	bool Tick(float DeltaTime)
+	{
+		return Evaluate(EvaluatedTime + DeltaTime);
+	}
 };
 
 /**
@@ -0,0 +1,71 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HitReactPhysicsState.h"
+#include "HitReactSpring.generated.h"
+
+class UHitReactProfile;
+struct FHitReactCompiledProfile;
+
+/**
+ * Physics-free approximation of a hit reaction on a single bone
+ * A damped spring rotates the bone in component space, scaled by the profile's blend envelope
+ */
+USTRUCT(BlueprintType)
+struct PROCHITREACT_API FHitReactSpring
+{
+	GENERATED_BODY()
+
+	FHitReactSpring()
+		: SimulatedBoneName(NAME_None)
+		, Profile(nullptr)
+		, CompiledProfile(nullptr)
+		, Offset(FVector::ZeroVector)
+		, AngularVelocity(FVector::ZeroVector)
+		, BlendWeight(0.f)
+	{}
+
+public:
+	/** Interpolation state handling for hit reactions -- Supports blend in, hold, and blend out */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=HitReact)
+	FHitReactPhysicsState PhysicsState;
+
+	/** Bone to rotate */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=HitReact)
+	FName SimulatedBoneName;
+
+	/** Profile that this spring is using */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=HitReact)
+	TObjectPtr<const UHitReactProfile> Profile;
+
+	/** Compiled copy of Profile read while ticking, held so that it survives the profile recompiling */
+	TSharedPtr<const FHitReactCompiledProfile, ESPMode::ThreadSafe> CompiledProfile;
+
+public:
+	/** Component space rotation away from the animated pose, as a rotation vector in radians */
+	UPROPERTY()
+	FVector Offset;
+
+	/** Component space angular velocity in radians per second */
+	UPROPERTY()
+	FVector AngularVelocity;
+
+	/** Current weight from the blend envelope */
+	UPROPERTY()
+	float BlendWeight;
+
+public:
+	/** Apply a hit reaction to the bone */
+	void HitReact(const TObjectPtr<const UHitReactProfile>& InProfile, const FName& BoneName, const FVector& InAngularVelocity);
+
+	/** Tick the hit reaction */
+	void Tick(float DeltaTime);
+
+	/** @return Component space rotation to apply to the bone */
+	FQuat GetRotation() const;
+
+	/** @return True if the hit reaction has completed */
+	bool HasCompleted() const;
+};
@@ -0,0 +1,63 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class USkeletalMeshComponent;
+class UPhysicsAsset;
+
+/**
+ * Finds the physics asset body nearest to a world location, without tracing against the mesh
+ * Body shapes are approximated by capsules and refreshed from the current pose at most once per frame
+ * Bounding spheres per body let most bodies be rejected without testing their shapes
+ */
+struct PROCHITREACT_API FHitReactBodyLookup
+{
+	/** Gather the body shapes from the mesh's physics asset, skipping ExcludedBones */
+	void Build(const USkeletalMeshComponent* InMesh, const TArray<FName>& ExcludedBones);
+
+	void Reset();
+
+	/** @return True if built for the mesh's current physics asset */
+	bool IsBuiltFor(const USkeletalMeshComponent* InMesh) const;
+
+	/** @return Bone of the body nearest to WorldLocation, None if there are no bodies */
+	FName FindNearest(const FVector& WorldLocation);
+
+	/** Find the bone of the body nearest to each location, refreshing the pose only once for all of them */
+	void FindNearest(TConstArrayView<FVector> WorldLocations, TArray<FName>& OutBoneNames);
+
+	int32 Num() const { return BoneNames.Num(); }
+
+private:
+	/** Capsule from A to B, a sphere if they are equal */
+	struct FShape
+	{
+		FVector A = FVector::ZeroVector;
+		FVector B = FVector::ZeroVector;
+		float Radius = 0.f;
+	};
+
+	/** Transform the shapes to world space for the current pose, if not done this frame */
+	void Refresh();
+
+	/** @return Index of the body nearest to WorldLocation, INDEX_NONE if there are no bodies */
+	int32 FindNearestIndex(const FVector& WorldLocation) const;
+
+	TWeakObjectPtr<const USkeletalMeshComponent> Mesh;
+	TWeakObjectPtr<const UPhysicsAsset> PhysicsAsset;
+
+	/** Per body */
+	TArray<FName> BoneNames;
+	TArray<int32> BoneIndices;
+	TArray<FSphere> WorldBounds;
+
+	/** Shapes for body i are ShapeOffsets[i] to ShapeOffsets[i + 1] */
+	TArray<int32> ShapeOffsets;
+	TArray<FShape> LocalShapes;
+	TArray<FShape> WorldShapes;
+
+	uint64 RefreshedFrame = MAX_uint64;
+};
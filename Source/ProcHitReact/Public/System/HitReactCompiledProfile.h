@@ -0,0 +1,113 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HitReactTypes.h"
+#include "Params/HitReactParams.h"
+#include "Physics/HitReactPhysicsState.h"
+
+class UHitReactProfile;
+
+/**
+ * Addresses a compiled profile in FHitReactProfileTable
+ */
+struct PROCHITREACT_API FHitReactProfileHandle
+{
+	int32 Index = INDEX_NONE;
+
+	/** Slot generation, so a handle to a released slot doesn't resolve to the profile that reused it */
+	uint32 Generation = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	bool operator==(const FHitReactProfileHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const FHitReactProfileHandle& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Immutable copy of the UHitReactProfile properties that are read while applying and simulating hit reacts
+ * Compiled when the profile loads so hot paths don't chase UObject pointers or hash maps, and can read it off the game thread
+ */
+struct PROCHITREACT_API FHitReactCompiledProfile
+{
+	FHitReactPhysicsStateParams BlendParams;
+	float MaxBlendWeight = 0.f;
+	float BoneBlendRate = 0.f;
+	float Cooldown = 0.f;
+	EHitReactMaxBlendHandling MaxBlendHandling = EHitReactMaxBlendHandling::Disabled;
+	int32 MaxActiveBlends = 0;
+	FHitReactEviction Eviction;
+	int32 LODThreshold = INDEX_NONE;
+	FGameplayTag Channel;
+	FHitReactSpringParams Spring;
+	FName PhysicalAnimProfile = NAME_None;
+	FName ConstraintProfile = NAME_None;
+
+	/** SubsequentImpulseScalars thresholds in ascending order */
+	TArray<float> SubsequentImpulseTimes;
+
+	/** SubsequentImpulseScalars scalars, matching SubsequentImpulseTimes */
+	TArray<float> SubsequentImpulseScalars;
+
+	/** RemapSimulatedBones sorted by the bone being remapped (the key) for binary search */
+	TArray<TPair<FName, FName>> BoneRemaps;
+
+	/** BoneOverrides flattened */
+	TArray<TPair<FName, FHitReactBoneOverride>> BoneOverrides;
+
+public:
+	/** Build from the profile's current properties */
+	void Compile(const UHitReactProfile* Profile);
+
+	/** @return Scalar for an impulse applied TimeSinceLastHitReact after the previous hit react */
+	float GetSubsequentImpulseScalar(float TimeSinceLastHitReact) const;
+
+	/** @return The bone to simulate in place of BoneName, or BoneName if it isn't remapped */
+	FName RemapSimulatedBone(const FName& BoneName) const;
+};
+
+typedef TSharedPtr<const FHitReactCompiledProfile, ESPMode::ThreadSafe> FHitReactCompiledProfilePtr;
+
+/**
+ * Global table of compiled profiles addressed by FHitReactProfileHandle
+ * Each profile owns a single slot, recompiling replaces the entry in place and releasing the slot frees it for reuse
+ * Entries are immutable and shared, so anything that outlives a recompile, e.g. an active blend, holds a FHitReactCompiledProfilePtr
+ */
+struct PROCHITREACT_API FHitReactProfileTable
+{
+	static FHitReactProfileTable& Get();
+
+	/** Compile the profile into the slot addressed by Handle, or a free slot if Handle is invalid or stale */
+	FHitReactProfileHandle Compile(const UHitReactProfile* Profile, FHitReactProfileHandle Handle = {});
+
+	/** Free the slot for reuse, anything still holding the compiled profile keeps it until it lets go */
+	void Release(FHitReactProfileHandle Handle);
+
+	/**
+	 * @return The compiled profile, or nullptr if the handle is invalid or stale
+	 * Only valid until the profile is recompiled or released on the game thread, use FindShared to hold onto it
+	 */
+	const FHitReactCompiledProfile* Find(FHitReactProfileHandle Handle) const;
+
+	/** @return Shared reference to the compiled profile, or nullptr if the handle is invalid or stale */
+	FHitReactCompiledProfilePtr FindShared(FHitReactProfileHandle Handle) const;
+
+	/** @return Number of profiles currently compiled */
+	int32 Num() const;
+
+private:
+	struct FSlot
+	{
+		FHitReactCompiledProfilePtr Compiled;
+		uint32 Generation = 0;
+	};
+
+	const FSlot* FindSlot(FHitReactProfileHandle Handle) const;
+
+	mutable FRWLock Lock;
+
+	TArray<FSlot> Slots;
+
+	/** Released slots available for reuse */
+	TArray<int32> FreeSlots;
+};
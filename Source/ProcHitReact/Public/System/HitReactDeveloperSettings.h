@@ -0,0 +1,79 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "HitReactDeveloperSettings.generated.h"
+
+class UHitReactBoneData;
+class UHitReactProfile;
+
+/**
+ * Project-wide settings for the HitReact system
+ */
+UCLASS(Config=Game, DefaultConfig, meta=(DisplayName="Hit React"))
+class PROCHITREACT_API UHitReactDeveloperSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Profiles that replicate as a compact index instead of a full asset path
+	 * Sorted by path when the registry is built, so the order here doesn't matter
+	 * Should contain every profile referenced by UHitReact::AvailableProfiles
+	 * Profiles not found here still replicate, but as a full asset path
+	 */
+	UPROPERTY(Config, EditAnywhere, Category=Networking)
+	TArray<TSoftObjectPtr<UHitReactProfile>> NetProfiles;
+
+	/**
+	 * Bone data that replicates as a compact index instead of a full asset path
+	 * Should contain every bone data referenced by UHitReact::AvailableBoneData
+	 */
+	UPROPERTY(Config, EditAnywhere, Category=Networking)
+	TArray<TSoftObjectPtr<UHitReactBoneData>> NetBoneData;
+
+	/**
+	 * Bone names that replicate as a compact index instead of a name
+	 * Typically the bones of your skeleton that receive hit reacts or impulses
+	 * Received bones are validated against the mesh before they are simulated
+	 */
+	UPROPERTY(Config, EditAnywhere, Category=Networking)
+	TArray<FName> NetBoneNames;
+
+	/**
+	 * Maximum number of meshes per world that hit reacts keep in a physics collision mode
+	 * When exceeded, the least recently hit mesh without an active hit react has its collision reverted
+	 * Set to 0 to disable
+	 */
+	UPROPERTY(Config, EditAnywhere, Category=Performance, meta=(UIMin="0", ClampMin="0"))
+	int32 MaxResidentPhysicsMeshes = 0;
+
+	/**
+	 * If true, awake hit react components take turns to update instead of all updating every frame
+	 * Each component updates once every TimeSliceFrames, and catches up on the time it skipped
+	 * The locally controlled player and components with a pending impulse always update every frame
+	 */
+	UPROPERTY(Config, EditAnywhere, Category=Performance)
+	bool bEnableTimeSlicing = false;
+
+	/** Number of frames over which components take turns to update */
+	UPROPERTY(Config, EditAnywhere, Category=Performance, meta=(EditCondition="bEnableTimeSlicing", UIMin="1", ClampMin="1", UIMax="8"))
+	int32 TimeSliceFrames = 2;
+
+	/**
+	 * Time per frame that components may spend updating, further components wait for a later frame
+	 * Components are never delayed beyond twice TimeSliceFrames
+	 * Set to 0 to disable
+	 */
+	UPROPERTY(Config, EditAnywhere, Category=Performance, meta=(EditCondition="bEnableTimeSlicing", UIMin="0", ClampMin="0", UIMax="2000", ForceUnits="us"))
+	float TimeSliceBudgetMicroseconds = 0.f;
+
+public:
+	UHitReactDeveloperSettings();
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+};
@@ -0,0 +1,52 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "HitReactLoadingSubsystem.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * An asset shared by every hit react component that uses it
+ */
+struct FHitReactSharedAsset
+{
+	/** Keeps the asset loaded while referenced */
+	TSharedPtr<FStreamableHandle> Handle;
+
+	/** Number of components using the asset */
+	int32 RefCount = 0;
+};
+
+/**
+ * Loads the profiles and bone data used by hit react components once per game instance
+ * Assets are ref counted and kept resident while any component uses them, so components spawned later
+ * initialize synchronously instead of repeating the load
+ */
+UCLASS()
+class PROCHITREACT_API UHitReactLoadingSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Shared assets by path */
+	TMap<FSoftObjectPath, FHitReactSharedAsset> Assets;
+
+	/** Combined handles waiting on shared loads, kept alive until they complete */
+	TArray<TSharedPtr<FStreamableHandle>> PendingLoads;
+
+public:
+	/**
+	 * Add a reference to each asset, loading any that aren't already loaded or in flight
+	 * @param OnLoaded Called once every asset has loaded, unless they are already loaded
+	 * @return True if every asset is already loaded and can be used immediately
+	 */
+	bool AcquireAssets(const TArray<FSoftObjectPath>& Paths, FSimpleDelegate OnLoaded);
+
+	/** Remove a reference to each asset, allowing it to unload once unreferenced */
+	void ReleaseAssets(const TArray<FSoftObjectPath>& Paths);
+
+	virtual void Deinitialize() override;
+};
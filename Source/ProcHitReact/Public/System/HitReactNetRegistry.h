@@ -0,0 +1,157 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/SoftObjectPtr.h"
+
+class UHitReactBoneData;
+class UHitReactProfile;
+
+/**
+ * Network-stable table of entries, sorted deterministically so that every machine resolves the same index
+ * Index 0 is reserved for null, entries begin at 1
+ */
+template<typename KeyType>
+struct THitReactNetTable
+{
+	/** Sorted entries */
+	TArray<KeyType> Entries;
+
+	/** Entry to net index */
+	TMap<KeyType, uint32> Lookup;
+
+	void Reset()
+	{
+		Entries.Reset();
+		Lookup.Reset();
+	}
+
+	/** @return Net index for the entry, or INDEX_NONE if it is not registered */
+	int32 Find(const KeyType& Key) const
+	{
+		const uint32* Index = Lookup.Find(Key);
+		return Index ? static_cast<int32>(*Index) : INDEX_NONE;
+	}
+
+	/** @return True if the net index resolves to an entry */
+	bool IsValidIndex(uint32 NetIndex) const
+	{
+		return NetIndex > 0 && NetIndex <= static_cast<uint32>(Entries.Num());
+	}
+};
+
+/**
+ * Project-wide registry that maps profiles, bone data and bone names to compact indices for replication
+ * Built from UHitReactDeveloperSettings, so the tables are identical on the server and all clients
+ * Anything not registered falls back to replicating the full asset path or name
+ */
+struct PROCHITREACT_API FHitReactNetRegistry
+{
+	static FHitReactNetRegistry& Get();
+
+	/** Rebuild the tables from UHitReactDeveloperSettings */
+	void Rebuild();
+
+	const THitReactNetTable<FSoftObjectPath>& GetProfiles() const { return Profiles; }
+	const THitReactNetTable<FSoftObjectPath>& GetBoneData() const { return BoneData; }
+	const THitReactNetTable<FName>& GetBoneNames() const { return BoneNames; }
+
+	/** @return True if the profile replicates as an index */
+	bool IsProfileRegistered(const FSoftObjectPath& Path) const { return Profiles.Find(Path) != INDEX_NONE; }
+
+	/** @return True if the bone data replicates as an index */
+	bool IsBoneDataRegistered(const FSoftObjectPath& Path) const { return BoneData.Find(Path) != INDEX_NONE; }
+
+public:
+	static void NetSerializeProfile(FArchive& Ar, TSoftObjectPtr<UHitReactProfile>& Profile)
+	{
+		NetSerializeSoftObject(Ar, Profile, Get().Profiles);
+	}
+
+	static void NetSerializeBoneData(FArchive& Ar, TSoftObjectPtr<UHitReactBoneData>& InBoneData)
+	{
+		NetSerializeSoftObject(Ar, InBoneData, Get().BoneData);
+	}
+
+	static void NetSerializeBoneName(FArchive& Ar, FName& BoneName);
+
+	/** Profiles requested by tag only send the tag, otherwise the profile is sent */
+	static void NetSerializeProfileOrTag(FArchive& Ar, TSoftObjectPtr<UHitReactProfile>& Profile, FGameplayTag& ProfileTag)
+	{
+		if (!NetSerializeProfileTag(Ar, ProfileTag))
+		{
+			NetSerializeProfile(Ar, Profile);
+		}
+	}
+
+	/**
+	 * Networked gameplay tags are written as their UGameplayTagsManager net index, otherwise as a name
+	 * @return True if a tag was serialized
+	 */
+	static bool NetSerializeProfileTag(FArchive& Ar, FGameplayTag& ProfileTag);
+
+	/** @return Net index of the tag, or INDEX_NONE if it isn't networked */
+	static int32 GetTagNetIndex(const FGameplayTag& Tag);
+
+	/** @return The tag for the net index, invalid if the index doesn't resolve */
+	static FGameplayTag GetTagFromNetIndex(uint32 NetIndex);
+
+private:
+	template<typename T>
+	static void NetSerializeSoftObject(FArchive& Ar, TSoftObjectPtr<T>& Object, const THitReactNetTable<FSoftObjectPath>& Table)
+	{
+		uint8 bIndexed = 0;
+		uint32 NetIndex = 0;
+		if (Ar.IsSaving())
+		{
+			if (Object.IsNull())
+			{
+				bIndexed = 1;
+			}
+			else
+			{
+				const int32 Found = Table.Find(Object.ToSoftObjectPath());
+				bIndexed = Found != INDEX_NONE ? 1 : 0;
+				NetIndex = bIndexed ? static_cast<uint32>(Found) : 0;
+			}
+		}
+
+		Ar.SerializeBits(&bIndexed, 1);
+		if (!bIndexed)
+		{
+			// Not registered, send the full path
+			Ar << Object;
+			return;
+		}
+
+		Ar.SerializeIntPacked(NetIndex);
+		if (Ar.IsLoading())
+		{
+			if (NetIndex == 0)
+			{
+				Object.Reset();
+			}
+			else if (Table.IsValidIndex(NetIndex))
+			{
+				Object = TSoftObjectPtr<T>(Table.Entries[NetIndex - 1]);
+			}
+			else
+			{
+				// Tables differ between machines
+				Object.Reset();
+				Ar.SetError();
+			}
+		}
+	}
+
+	FHitReactNetRegistry()
+	{
+		Rebuild();
+	}
+
+	THitReactNetTable<FSoftObjectPath> Profiles;
+	THitReactNetTable<FSoftObjectPath> BoneData;
+	THitReactNetTable<FName> BoneNames;
+};
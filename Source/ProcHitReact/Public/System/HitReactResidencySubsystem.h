@@ -0,0 +1,39 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HitReactResidencySubsystem.generated.h"
+
+class UHitReact;
+
+/**
+ * Tracks the hit react components that have switched their mesh to a physics collision mode
+ * Enforces UHitReactDeveloperSettings::MaxResidentPhysicsMeshes by evicting the least recently hit
+ */
+UCLASS()
+class PROCHITREACT_API UHitReactResidencySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Resident components, least recently hit first */
+	UPROPERTY()
+	TArray<TWeakObjectPtr<UHitReact>> Residents;
+
+public:
+	/** Mark the component as resident and most recently hit, evicting others if over the cap */
+	void MarkResident(UHitReact* HitReact);
+
+	/** Stop tracking the component, does not revert its collision */
+	void RemoveResident(const UHitReact* HitReact);
+
+	int32 GetNumResidents() const { return Residents.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Evict the least recently hit components until we're within the cap */
+	void EnforceCap(const UHitReact* Exclude);
+};
@@ -0,0 +1,51 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "HitReactScheduler.generated.h"
+
+class UHitReact;
+
+/**
+ * Time slices updates across awake hit react components
+ * Each component is given a slot within a window of TimeSliceFrames, and receives the time it skipped on its turn
+ * Configured in the Hit React project settings, all components update every frame when disabled
+ */
+UCLASS()
+class PROCHITREACT_API UHitReactScheduler : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Update slot for each component within the window */
+	TMap<TObjectKey<UHitReact>, int32> Slots;
+
+	/** Slot given to the next component */
+	int32 NextSlot = 0;
+
+	/** Frame that SpentMicroseconds was accumulated for */
+	uint64 BudgetFrame = 0;
+
+	/** Time spent updating components this frame */
+	double SpentMicroseconds = 0.0;
+
+public:
+	/**
+	 * @param bEveryFrame If true the component always updates, e.g. for the local player
+	 * @param FramesSinceUpdate Number of frames the component has skipped, overdue components are prioritized
+	 * @return True if the component should update this frame
+	 */
+	bool ShouldUpdate(const UHitReact* HitReact, bool bEveryFrame, int32 FramesSinceUpdate);
+
+	/** Count the time spent updating a component against this frame's budget */
+	void ReportUpdateTime(double Microseconds);
+
+	/** Release the component's slot, e.g. when it goes to sleep */
+	void Unregister(const UHitReact* HitReact);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+};
@@ -0,0 +1,25 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "AnimGraphNode_HitReactRigidBody.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimGraphNode_HitReactRigidBody)
+
+#define LOCTEXT_NAMESPACE "AnimGraphNode_HitReactRigidBody"
+
+FText UAnimGraphNode_HitReactRigidBody::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return GetControllerDescription();
+}
+
+FText UAnimGraphNode_HitReactRigidBody::GetTooltipText() const
+{
+	return LOCTEXT("TooltipText", "Simulates hit reacts from the owner's Hit React component when its Backend is set to Anim Node. Bodies are blended with the input pose by their hit react weight.");
+}
+
+FText UAnimGraphNode_HitReactRigidBody::GetControllerDescription() const
+{
+	return LOCTEXT("ControllerDescription", "Hit React RigidBody");
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,25 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "AnimGraphNode_HitReactSpring.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimGraphNode_HitReactSpring)
+
+#define LOCTEXT_NAMESPACE "AnimGraphNode_HitReactSpring"
+
+FText UAnimGraphNode_HitReactSpring::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return GetControllerDescription();
+}
+
+FText UAnimGraphNode_HitReactSpring::GetTooltipText() const
+{
+	return LOCTEXT("TooltipText", "Rotates bones using the physics-free spring hit reacts from the owner's Hit React component. Springs are used by profiles beyond their LOD Threshold.");
+}
+
+FText UAnimGraphNode_HitReactSpring::GetControllerDescription() const
+{
+	return LOCTEXT("ControllerDescription", "Hit React Spring");
+}
+
+#undef LOCTEXT_NAMESPACE
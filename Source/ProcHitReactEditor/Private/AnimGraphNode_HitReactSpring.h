@@ -0,0 +1,33 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AnimGraphNode_SkeletalControlBase.h"
+#include "Animation/AnimNode_HitReactSpring.h"
+#include "AnimGraphNode_HitReactSpring.generated.h"
+
+/**
+ * Anim Graph node for FAnimNode_HitReactSpring
+ */
+UCLASS()
+class UAnimGraphNode_HitReactSpring : public UAnimGraphNode_SkeletalControlBase
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category=Settings)
+	FAnimNode_HitReactSpring Node;
+
+public:
+	// UEdGraphNode interface
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	// End of UEdGraphNode interface
+
+protected:
+	// UAnimGraphNode_SkeletalControlBase interface
+	virtual FText GetControllerDescription() const override;
+	virtual const FAnimNode_SkeletalControlBase* GetNode() const override { return &Node; }
+	// End of UAnimGraphNode_SkeletalControlBase interface
+};
@@ -19,6 +19,9 @@ public class ProcHitReactEditor : ModuleRules
                 "CoreUObject",
                 "Engine",
                 "ProcHitReact",
+                "AnimGraph",
+                "AnimGraphRuntime",
+                "BlueprintGraph",
             }
         );
     }